@@ -3,6 +3,8 @@
 #include <Swoosh/Ease.h>
 #include <Swoosh/EmbedGLSL.h>
 
+#include "../bnEngine.h"
+
 using namespace swoosh;
 
 #ifdef __ANDROID__
@@ -70,7 +72,7 @@ namespace {
 template<int cols, int rows>
 class CheckerboardCustom : public Segue {
 private:
-  sf::Texture* temp, * temp2;
+  sf::RenderTexture* temp, * temp2; /*!< Pooled targets the last and next activities draw into */
   sf::Shader shader;
   bool loaded;
 
@@ -80,49 +82,36 @@ public:
     double duration = getDuration().asMilliseconds();
     double alpha = ease::linear(elapsed, duration, 1.0);
 
-    this->drawLastActivity(surface);
-
-    surface.display(); // flip and ready the buffer
+    if (!temp) temp = ENGINE.AcquireRenderTarget(surface.getSize());
+    if (!temp2) temp2 = ENGINE.AcquireRenderTarget(surface.getSize());
 
 #ifdef __ANDROID__
     if (!loaded) {
-        temp = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
-        temp->flip(true);
-    }
-#else
-    temp = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
 #endif
+      temp->clear(sf::Color::Transparent);
+      this->drawLastActivity(*temp);
+      temp->display(); // flip and ready the buffer
 
-    sf::Sprite sprite(*temp);
-
-    surface.clear(sf::Color::Transparent);
-    this->drawNextActivity(surface);
-
-    surface.display(); // flip and ready the buffer
+      temp2->clear(sf::Color::Transparent);
+      this->drawNextActivity(*temp2);
+      temp2->display(); // flip and ready the buffer
 
+      loaded = true;
 #ifdef __ANDROID__
-if(!loaded) {
-    temp2 = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
-    temp2->flip(true);
-    loaded = true;
-}
-#else
-    temp2 = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
+    }
 #endif
 
+    sf::Sprite sprite(temp->getTexture());
+
     shader.setUniform("progress", (float)alpha);
-    shader.setUniform("texture2", *temp2);
-    shader.setUniform("texture", *temp);
+    shader.setUniform("texture2", temp2->getTexture());
+    shader.setUniform("texture", temp->getTexture());
 
     sf::RenderStates states;
     states.shader = &shader;
 
+    surface.clear(sf::Color::Transparent);
     surface.draw(sprite, states);
-
-#ifndef __ANDROID__
-    delete temp;
-    delete temp2;
-#endif
   }
 
   CheckerboardCustom(sf::Time duration, Activity* last, Activity* next) : Segue(duration, last, next) {
@@ -162,10 +151,8 @@ if(!loaded) {
   }
 
   virtual ~CheckerboardCustom() {
-#ifdef __ANDROID__
-      if(temp) delete temp;
-      if(temp2) delete temp2;
-#endif
+    ENGINE.ReleaseRenderTarget(temp);
+    ENGINE.ReleaseRenderTarget(temp2);
   }
 };
 
@@ -3,6 +3,8 @@
 #include <Swoosh/Ease.h>
 #include <Swoosh/EmbedGLSL.h>
 
+#include "../bnEngine.h"
+
 using namespace swoosh;
 
 namespace {
@@ -88,7 +90,7 @@ namespace {
 template<int percent_power> // divided by 100 to yeild %
 class CrossZoomCustom : public Segue {
 private:
-  sf::Texture* temp;
+  sf::RenderTexture* temp, * temp2; /*!< Pooled targets the last and next activities draw into */
   sf::Shader shader;
 
 public:
@@ -97,42 +99,44 @@ public:
     double duration = getDuration().asMilliseconds();
     double alpha = ease::linear(elapsed, duration, 1.0);
 
-    this->drawLastActivity(surface);
-
-    surface.display(); // flip and ready the buffer
+    if (!temp) temp = ENGINE.AcquireRenderTarget(surface.getSize());
+    if (!temp2) temp2 = ENGINE.AcquireRenderTarget(surface.getSize());
 
-    if (temp) delete temp;
-    temp = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
+    temp->clear(sf::Color::Transparent);
+    this->drawLastActivity(*temp);
+    temp->display(); // flip and ready the buffer
 
-    sf::Sprite sprite(*temp);
-
-    surface.clear(sf::Color::Transparent);
-    this->drawNextActivity(surface);
+    temp2->clear(sf::Color::Transparent);
+    this->drawNextActivity(*temp2);
+    temp2->display(); // flip and ready the buffer
 
-    surface.display(); // flip and ready the buffer
-
-    sf::Texture* temp2 = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
+    sf::Sprite sprite(temp->getTexture());
 
     shader.setUniform("progress", (float)alpha);
-    shader.setUniform("texture2", *temp2);
-    shader.setUniform("texture", *temp);
+    shader.setUniform("texture2", temp2->getTexture());
+    shader.setUniform("texture", temp->getTexture());
 
     sf::RenderStates states;
     states.shader = &shader;
 
+    surface.clear(sf::Color::Transparent);
     surface.draw(sprite, states);
   }
 
   CrossZoomCustom(sf::Time duration, Activity* last, Activity* next) : Segue(duration, last, next) {
     /* ... */
     temp = nullptr;
+    temp2 = nullptr;
 
     shader.loadFromMemory(::CROSSZOOM_FRAG_SHADER, sf::Shader::Fragment);
     shader.setUniform("strength", (float)percent_power/100.0f);
 
   }
 
-  virtual ~CrossZoomCustom() { ; }
+  virtual ~CrossZoomCustom() {
+    ENGINE.ReleaseRenderTarget(temp);
+    ENGINE.ReleaseRenderTarget(temp2);
+  }
 };
 
 using CrossZoom = CrossZoomCustom<40>;
@@ -3,6 +3,8 @@
 #include <Swoosh/Segue.h>
 #include <Swoosh/Ease.h>
 
+#include "../bnEngine.h"
+
 using namespace swoosh;
 
 #ifdef __ANDROID__
@@ -106,7 +108,7 @@ namespace {
 template<int direction>
 class DiamondTileSwipe : public Segue {
 private:
-  sf::Texture* temp;
+  sf::RenderTexture* temp; /*!< Pooled target the visible activity draws into */
   sf::Shader shader;
 
 public:
@@ -115,30 +117,27 @@ public:
     double duration = getDuration().asMilliseconds();
     double alpha = ease::wideParabola(elapsed, duration, 1.0);
 
-    if (elapsed < duration * 0.5)
-      this->drawLastActivity(surface);
-    else
-      this->drawNextActivity(surface);
-
-    surface.display(); // flip and ready the buffer
+    if (!temp) temp = ENGINE.AcquireRenderTarget(surface.getSize());
 
-    if (temp) delete temp;
+    temp->clear(sf::Color::Transparent);
 
-    temp = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
+    if (elapsed < duration * 0.5)
+      this->drawLastActivity(*temp);
+    else
+      this->drawNextActivity(*temp);
 
-#ifdef __ANDROID__
-    temp->flip(true);
-#endif
+    temp->display(); // flip and ready the buffer
 
-    sf::Sprite sprite(*temp);
+    sf::Sprite sprite(temp->getTexture());
 
-    shader.setUniform("texture", *temp);
+    shader.setUniform("texture", temp->getTexture());
     shader.setUniform("direction", direction);
     shader.setUniform("time", (float)alpha);
 
     sf::RenderStates states;
     states.shader = &shader;
 
+    surface.clear(sf::Color::Transparent);
     surface.draw(sprite, states);
   }
 
@@ -169,5 +168,5 @@ public:
 #endif
   }
 
-  virtual ~DiamondTileSwipe() { if (temp) { delete temp; } }
+  virtual ~DiamondTileSwipe() { ENGINE.ReleaseRenderTarget(temp); }
 };
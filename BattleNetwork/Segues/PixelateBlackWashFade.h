@@ -3,6 +3,8 @@
 #include <Swoosh/Ease.h>
 #include <Swoosh/EmbedGLSL.h>
 
+#include "../bnEngine.h"
+
 using namespace swoosh;
 
 #ifndef __ANDROID__
@@ -58,7 +60,7 @@ private:
     bool loaded;
     bool nextScreen;
 
-    sf::Texture *temp;
+    sf::RenderTexture *temp; /*!< Pooled target the visible activity draws into */
 
 public:
     virtual void onDraw(sf::RenderTexture &surface) {
@@ -66,32 +68,33 @@ public:
         double duration = getDuration().asMilliseconds();
         double alpha = ease::wideParabola(elapsed, duration, 1.0);
 
-        if (elapsed <= duration * 0.5)
-            this->drawLastActivity(surface);
-        else {
-            if (loaded && !nextScreen) {
-                loaded = false;
-                nextScreen = true;
-            }
+        if (!temp) temp = ENGINE.AcquireRenderTarget(surface.getSize());
 
-            this->drawNextActivity(surface);
+        if (elapsed > duration * 0.5 && loaded && !nextScreen) {
+            loaded = false;
+            nextScreen = true;
         }
 
-        surface.display();
-
 #ifdef __ANDROID__
         if (!loaded) {
-            temp = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
-            temp->flip(true);
+#endif
+            temp->clear(sf::Color::Transparent);
+
+            if (elapsed <= duration * 0.5)
+                this->drawLastActivity(*temp);
+            else
+                this->drawNextActivity(*temp);
+
+            temp->display(); // flip and ready the buffer
+
             loaded = true;
+#ifdef __ANDROID__
         }
-#else
-        temp = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
 #endif
 
-        sf::Sprite sprite(*temp);
+        sf::Sprite sprite(temp->getTexture());
 
-        shader.setUniform("texture", *temp);
+        shader.setUniform("texture", temp->getTexture());
         shader.setUniform("pixel_threshold", (float) alpha / 15.0f);
         sf::RenderStates states;
         states.shader = &shader;
@@ -115,6 +118,7 @@ public:
     PixelateBlackWashFade(sf::Time duration, Activity *last, Activity *next) : Segue(duration, last,
                                                                                      next) {
         loaded = nextScreen = false;
+        temp = nullptr;
 
 #ifdef __ANDROID__
         shader.loadFromMemory("uniform mat4 viewMatrix;\n"
@@ -141,11 +145,7 @@ public:
     }
 
     virtual ~PixelateBlackWashFade() {
-#ifdef __ANDROID__
-        if (temp) {
-            delete temp;
-        }
-#endif
+        ENGINE.ReleaseRenderTarget(temp);
     }
 };
 
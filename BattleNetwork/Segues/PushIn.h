@@ -2,12 +2,14 @@
 #include <Swoosh/Segue.h>
 #include <Swoosh/Ease.h>
 
+#include "../bnEngine.h"
+
 using namespace swoosh;
 
 template<int direction>
 class PushIn : public Segue {
 private:
-    sf::Texture temp, temp2;
+    sf::RenderTexture* temp, * temp2; /*!< Pooled targets the last and next activities draw into */
     bool loaded;
 
 public:
@@ -17,21 +19,26 @@ public:
         double duration = getDuration().asMilliseconds();
         double alpha = ease::linear(elapsed, duration, 1.0);
 
-        surface.clear(this->getLastActivityBGColor());
-        this->drawLastActivity(surface);
-
-        surface.display(); // flip and ready the buffer
+        if (!temp) temp = ENGINE.AcquireRenderTarget(surface.getSize());
+        if (!temp2) temp2 = ENGINE.AcquireRenderTarget(surface.getSize());
 
 #ifdef __ANDROID__
         if(!loaded) {
-                temp = sf::Texture(surface.getTexture()); // Make a copy of the source texture
-                temp.flip(true);
+#endif
+            temp->clear(this->getLastActivityBGColor());
+            this->drawLastActivity(*temp);
+            temp->display(); // flip and ready the buffer
+
+            temp2->clear(this->getNextActivityBGColor());
+            this->drawNextActivity(*temp2);
+            temp2->display(); // flip and ready the buffer
+
+            loaded = true; // both targets are drawn by now
+#ifdef __ANDROID__
         }
-#else
-        temp = sf::Texture(surface.getTexture()); // Make a copy of the source texture
 #endif
 
-        sf::Sprite left(temp);
+        sf::Sprite left(temp->getTexture());
 
         int lr = 0;
         int ud = 0;
@@ -43,27 +50,11 @@ public:
 
         left.setPosition((float)(lr * alpha * left.getTexture()->getSize().x), (float)(ud * alpha * left.getTexture()->getSize().y));
 
-        surface.clear(this->getNextActivityBGColor());
-
-        this->drawNextActivity(surface);
-
-        surface.display(); // flip and ready the buffer
-
-
-#ifdef __ANDROID__
-        if(!loaded) {
-                temp2 = sf::Texture(surface.getTexture());
-                temp2.flip(true);
-                loaded = true; // both textures are loaded by now
-        }
-#else
-       temp2 = sf::Texture(surface.getTexture());
-#endif
-
-        sf::Sprite right(temp2);
+        sf::Sprite right(temp2->getTexture());
 
         right.setPosition((float)(-lr * (1.0-alpha) * right.getTexture()->getSize().x), (float)(-ud * (1.0-alpha) * right.getTexture()->getSize().y));
 
+        surface.clear(this->getNextActivityBGColor());
         surface.draw(left);
         surface.draw(right);
     }
@@ -71,7 +62,12 @@ public:
     PushIn(sf::Time duration, Activity* last, Activity* next) : Segue(duration, last, next) {
         /* ... */
         loaded = false;
+        temp = nullptr;
+        temp2 = nullptr;
     }
 
-    virtual ~PushIn() { }
+    virtual ~PushIn() {
+        ENGINE.ReleaseRenderTarget(temp);
+        ENGINE.ReleaseRenderTarget(temp2);
+    }
 };
@@ -2,12 +2,14 @@
 #include <Swoosh/Segue.h>
 #include <Swoosh/Ease.h>
 
+#include "../bnEngine.h"
+
 using namespace swoosh;
 
 template<int direction>
 class SlideIn : public Segue {
 private:
-  sf::Texture* temp;
+  sf::RenderTexture* temp, * temp2; /*!< Pooled targets the last and next activities draw into */
 
 public:
 
@@ -16,14 +18,14 @@ public:
     double duration = getDuration().asMilliseconds();
     double alpha = ease::linear(elapsed, duration, 1.0);
 
-    this->drawLastActivity(surface);
-
-    surface.display(); // flip and ready the buffer
+    if (!temp) temp = ENGINE.AcquireRenderTarget(surface.getSize());
+    if (!temp2) temp2 = ENGINE.AcquireRenderTarget(surface.getSize());
 
-    if (temp) delete temp;
-    temp = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
+    temp->clear(sf::Color::Transparent);
+    this->drawLastActivity(*temp);
+    temp->display(); // flip and ready the buffer
 
-    sf::Sprite left(*temp); 
+    sf::Sprite left(temp->getTexture());
 
     int lr = 0;
     int ud = 0;
@@ -33,12 +35,11 @@ public:
     if (direction == 2) ud = -1;
     if (direction == 3) ud = 1;
 
-    surface.clear();
+    temp2->clear();
+    this->drawNextActivity(*temp2);
+    temp2->display(); // flip and ready the buffer
 
-    this->drawNextActivity(surface);
-
-    surface.display(); // flip and ready the buffer
-    sf::Sprite right(surface.getTexture());
+    sf::Sprite right(temp2->getTexture());
 
     right.setPosition(-lr * (1-alpha) * right.getTexture()->getSize().x, -ud * (1-alpha) * right.getTexture()->getSize().y);
 
@@ -52,7 +53,11 @@ public:
   SlideIn(sf::Time duration, Activity* last, Activity* next) : Segue(duration, last, next) { 
     /* ... */ 
     temp = nullptr;
+    temp2 = nullptr;
   }
 
-  virtual ~SlideIn() { ; }
+  virtual ~SlideIn() {
+    ENGINE.ReleaseRenderTarget(temp);
+    ENGINE.ReleaseRenderTarget(temp2);
+  }
 };
@@ -3,6 +3,8 @@
 #include <Swoosh/Ease.h>
 #include <Swoosh/EmbedGLSL.h>
 
+#include "../bnEngine.h"
+
 using namespace swoosh;
 
 #ifdef __ANDROID__
@@ -63,7 +65,7 @@ namespace {
 
 class ZoomFadeIn : public Segue {
 private:
-  sf::Texture* temp;
+  sf::RenderTexture* temp, * temp2; /*!< Pooled targets the last and next activities draw into */
   sf::Shader shader;
 
 public:
@@ -72,38 +74,40 @@ public:
     double duration = getDuration().asMilliseconds();
     double alpha = ease::linear(elapsed, duration, 1.0);
 
-    this->drawLastActivity(surface);
-
-    surface.display(); // flip and ready the buffer
+    if (!temp) temp = ENGINE.AcquireRenderTarget(surface.getSize());
+    if (!temp2) temp2 = ENGINE.AcquireRenderTarget(surface.getSize());
 
-    if (temp) delete temp;
-    temp = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
+    temp->clear(sf::Color::Transparent);
+    this->drawLastActivity(*temp);
+    temp->display(); // flip and ready the buffer
 
-    sf::Sprite sprite(*temp);
-
-    surface.clear(sf::Color::Transparent);
-    this->drawNextActivity(surface);
+    temp2->clear(sf::Color::Transparent);
+    this->drawNextActivity(*temp2);
+    temp2->display(); // flip and ready the buffer
 
-    surface.display(); // flip and ready the buffer
-
-    sf::Texture* temp2 = new sf::Texture(surface.getTexture()); // Make a copy of the source texture
+    sf::Sprite sprite(temp->getTexture());
 
     shader.setUniform("progress", (float)alpha);
-    shader.setUniform("texture2", *temp2);
-    shader.setUniform("texture", *temp);
+    shader.setUniform("texture2", temp2->getTexture());
+    shader.setUniform("texture", temp->getTexture());
 
     sf::RenderStates states;
     states.shader = &shader;
 
+    surface.clear(sf::Color::Transparent);
     surface.draw(sprite, states);
   }
 
   ZoomFadeIn(sf::Time duration, Activity* last, Activity* next) : Segue(duration, last, next) {
     /* ... */
     temp = nullptr;
+    temp2 = nullptr;
 
     shader.loadFromMemory(::ZOOM_FADEIN_FRAG_SHADER, sf::Shader::Fragment);
   }
 
-  virtual ~ZoomFadeIn() { ; }
+  virtual ~ZoomFadeIn() {
+    ENGINE.ReleaseRenderTarget(temp);
+    ENGINE.ReleaseRenderTarget(temp2);
+  }
 };
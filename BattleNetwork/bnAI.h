@@ -1,5 +1,6 @@
 #pragma once
 #include "bnAIState.h"
+#include "bnAIStateSlot.h"
 #include "bnEntity.h"
 #include "bnAgent.h"
 #include "bnNoState.h"
@@ -14,6 +15,8 @@
  * the Entity's source code.
  * 
  * The SM uses a delayed state change so as not to cause undefined behavior.
+ * The active and queued states live in two slots inside the AI and swap roles
+ * on every change, so transitions do not allocate.
  * 
  * @warning It is not safe to call Update() in any AI state
  */
@@ -24,6 +27,8 @@ private:
   CharacterT* ref; /*!< AI of this instance */
   bool isUpdating; /*!< Safely ignore any extra Update() requests */
   AIState<CharacterT>* queuedState;
+  AIStateSlot<CharacterT> slots[2]; /*!< Storage for the active and the queued state */
+  int activeSlot; /*!< Which slot holds stateMachine */
   int priorityLevel; 
   bool priorityLocked;
 public:
@@ -36,16 +41,18 @@ public:
    */
   AI(CharacterT* _ref) : Agent() { 
     stateMachine = queuedState = nullptr; 
+    activeSlot = 0;
     ref = _ref;
+    ref->template Tag<Agent>(this);
     isUpdating = false;
     priorityLocked = false;
     priorityLevel = 999;
   }
   
   /**
-   * @brief Deletes the state machine object and Frees target
+   * @brief Frees target. The slots destroy the active and queued states.
    */
-  ~AI() { if (stateMachine) { delete stateMachine; } ref = nullptr; this->FreeTarget(); }
+  ~AI() { ref = nullptr; this->FreeTarget(); }
 
   void InvokeDefaultState() {
     using DefaultState = typename CharacterT::DefaultState;
@@ -78,8 +85,8 @@ public:
     }
 
     if (change) {
-      if (queuedState) { delete queuedState; }
-      queuedState = new U();
+      // Replaces any state already queued
+      queuedState = slots[1 - activeSlot].template Emplace<U>();
 
       priorityLevel = U::PriorityLevel;
     }
@@ -104,8 +111,7 @@ template<typename U, typename ...Args>
     }
 
     if (change) {
-      if (queuedState) { delete queuedState; }
-      queuedState = new U(args...);
+      queuedState = slots[1 - activeSlot].template Emplace<U>(args...);
 
       priorityLevel = U::PriorityLevel;
     }
@@ -128,18 +134,23 @@ template<typename U, typename ...Args>
       if (queuedState != nullptr) {
         stateMachine->OnLeave(*ref);
 
-        AIState<CharacterT>* oldState = stateMachine;
+        // OnLeave may have queued another state. Swap slots, then destroy the old state
+        // before OnEnter so a change requested there has a free slot to go into.
+        int oldSlot = activeSlot;
+        activeSlot = 1 - activeSlot;
         stateMachine = queuedState;
-        stateMachine->OnEnter(*ref);
-        delete oldState;
         queuedState = nullptr;
+        slots[oldSlot].Reset();
+
+        stateMachine->OnEnter(*ref);
       }
     }
     else {
       if (queuedState != nullptr) {
+        activeSlot = 1 - activeSlot;
         stateMachine = queuedState;
-        stateMachine->OnEnter(*ref);
         queuedState = nullptr;
+        stateMachine->OnEnter(*ref);
       }
     }
 
@@ -0,0 +1,89 @@
+/*! \file bnAIStateSlot.h */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <typeinfo>
+#include <utility>
+
+#include "bnAIState.h"
+#include "bnLogger.h"
+
+/**
+ * Bytes reserved inline for one AI state. Every state in the game fits.
+ * A state larger than this still works but is heap allocated, and a warning
+ * is logged the first time it is built.
+ */
+constexpr std::size_t AI_STATE_CAPACITY = 256;
+
+/**
+ * @class AIStateSlot
+ * @brief Owns at most one AI state, constructed in place in a fixed buffer
+ *
+ * AI state machines change state several times a second. Constructing into a
+ * slot that lives inside the AI instead of calling new keeps those transitions
+ * off the heap.
+ */
+template<typename CharacterT>
+class AIStateSlot {
+public:
+  AIStateSlot() : state(nullptr), onHeap(false) { }
+
+  AIStateSlot(const AIStateSlot&) = delete;
+  AIStateSlot& operator=(const AIStateSlot&) = delete;
+
+  ~AIStateSlot() { Reset(); }
+
+  /**
+   * @brief Destroys the state in the slot, if any, and constructs U in its place
+   * @return the new state
+   */
+  template<typename U, typename ...Args>
+  AIState<CharacterT>* Emplace(Args&&... args) {
+    Reset();
+
+    if constexpr (sizeof(U) <= AI_STATE_CAPACITY && alignof(U) <= alignof(std::max_align_t)) {
+      state = new (storage) U(std::forward<Args>(args)...);
+      onHeap = false;
+    }
+    else {
+      static bool warned = false;
+
+      if (!warned) {
+        warned = true;
+        BN_LOGF(Warning, Battle, "AI state %s needs %u bytes and does not fit its %u byte slot. It is heap allocated.",
+          typeid(U).name(), (unsigned)sizeof(U), (unsigned)AI_STATE_CAPACITY);
+      }
+
+      state = new U(std::forward<Args>(args)...);
+      onHeap = true;
+    }
+
+    return state;
+  }
+
+  /**
+   * @brief Destroys the state in the slot. The slot is then empty.
+   */
+  void Reset() {
+    if (!state) return;
+
+    AIState<CharacterT>* old = state;
+    state = nullptr;
+
+    if (onHeap) {
+      delete old;
+    }
+    else {
+      old->~AIState<CharacterT>();
+    }
+  }
+
+  AIState<CharacterT>* Get() const { return state; }
+
+private:
+  alignas(std::max_align_t) unsigned char storage[AI_STATE_CAPACITY];
+  AIState<CharacterT>* state; /*!< Points into storage, or to the heap for oversized states */
+  bool onHeap;
+};
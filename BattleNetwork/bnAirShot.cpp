@@ -24,7 +24,7 @@ AirShot::AirShot(Field* _field, Team _team, int _damage) : Spell(_field, _team)
   hit = false;
   progress = 0.0f;
   hitHeight = 10.0f;
-  random = rand() % 20 - 20;
+  random = GetField()->GetRandom().Next(20) - 20;
   cooldown = 0.0f;
 
   SetDirection(Direction::RIGHT);
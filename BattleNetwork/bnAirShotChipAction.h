@@ -2,12 +2,14 @@
 #include "bnChipAction.h"
 #include "bnAnimation.h"
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class SpriteSceneNode;
 class Character;
 class AirShotChipAction : public ChipAction {
 private:
   sf::Sprite airshot;
+  std::shared_ptr<sf::Texture> airshotTexture;
   SpriteSceneNode* attachment;
   Animation attachmentAnim;
   int damage;
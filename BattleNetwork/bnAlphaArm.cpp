@@ -79,7 +79,7 @@ AlphaArm::AlphaArm(Field* _field, Team _team, AlphaArm::Type type)
     animComponent->SetAnimation("LEFT_CLAW_SWIPE");
     SetSlideTime(sf::seconds(0.13f)); // 8 frames in 60 seconds
     SetDirection(Direction::LEFT);
-    changeState = (rand() % 10 < 5) ? TileState::POISON : TileState::ICE;
+    changeState = (GetField()->GetRandom().Next(10) < 5) ? TileState::POISON : TileState::ICE;
     this->SetLayer(-1);
     break;
   }
@@ -201,7 +201,7 @@ const bool AlphaArm::OnHit(const Hit::Properties props) {
 }
 
 void AlphaArm::Attack(Character* other) {
-  Obstacle* isObstacle = dynamic_cast<Obstacle*>(other);
+  Obstacle* isObstacle = other->As<Obstacle>();
 
   if (isObstacle) {
     auto props = Hit::DefaultProperties;
@@ -21,7 +21,7 @@ void AlphaClawSwipeState::OnEnter(AlphaCore& a) {
   }
 
   if (!last) {
-    last = a.GetField()->GetAt(1 + (rand() % 3), 1);
+    last = a.GetField()->GetAt(1 + a.GetField()->GetRandom().Next(3), 1);
   }
 
   // spawn right claw
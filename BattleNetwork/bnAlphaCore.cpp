@@ -19,6 +19,9 @@
 
 #define RESOURCE_PATH "resources/mobs/alpha/alpha.animation"
 
+// Looked up every frame while the core is exposed
+static const int SHOOT_POINT = FramePoints::Intern("SHOOT");
+
 AlphaCore::AlphaCore(Rank _rank)
   : BossPatternAI<AlphaCore>(this), Character(_rank) {
   Entity::team = Team::BLUE;
@@ -287,7 +290,7 @@ void AlphaCore::OpenShoulderGuns()
 
   // TODO: WHY CANT MY NODES JUST LINK UP TO THE POINTS?
   auto bounds = leftShoulder->getLocalBounds();
-  auto offset = animation.GetPoint("SHOOT") - sf::Vector2f(bounds.left, bounds.top);
+  auto offset = animation.GetPoint(SHOOT_POINT) - sf::Vector2f(bounds.left, bounds.top);
 
   leftShoulderShoot->setPosition(-offset.x, 0);
 
@@ -295,7 +298,7 @@ void AlphaCore::OpenShoulderGuns()
   animation.SetFrame(2, *rightShoulder);
 
   bounds = rightShoulder->getLocalBounds();
-  offset = animation.GetPoint("SHOOT") - sf::Vector2f(bounds.left, bounds.top);
+  offset = animation.GetPoint(SHOOT_POINT) - sf::Vector2f(bounds.left, bounds.top);
 
   rightShoulderShoot->setPosition(-offset.x+10.0f, 5.0f);
 }
@@ -27,7 +27,8 @@ Animation::Animation(const Animation& rhs) {
 
 Animation & Animation::operator=(const Animation & rhs)
 {
-  this->animations = rhs.animations;
+  this->data = rhs.data;
+  this->overrides = rhs.overrides;
   this->animator = rhs.animator;
   this->currAnimation = rhs.currAnimation;
   this->path = rhs.path;
@@ -39,123 +40,37 @@ Animation::~Animation() {
 }
 
 void Animation::Reload() {
-  int frameAnimationIndex = -1;
-  vector<FrameList> frameLists;
-  string currentState = "";
-  float currentAnimationDuration = 0.0f;
-  int currentWidth = 0;
-  int currentHeight = 0;
-  bool legacySupport = false;
   progress = 0;
-  string data = FileUtil::Read(path);
-  int endline = 0;
-  do {
-    endline = (int)data.find("\n");
-    string line = data.substr(0, endline);
-
-    // NOTE: Support older animation files until we upgrade completely...
-    if (line.find("VERSION") != string::npos) {
-      string version = ValueOf("VERSION", line);
-      if (version == "1.0") legacySupport = true;
+  data = ANIMATIONS.Load(path);
+}
 
-    }
-    else if (line.find("animation") != string::npos) {
-      if (!frameLists.empty()) {
-        //std::cout << "animation total seconds: " << sf::seconds(currentAnimationDuration).asSeconds() << "\n";
-        //std::cout << "animation name push " << currentState << endl;
-        animations.insert(std::make_pair(currentState, frameLists.at(frameAnimationIndex)));
-        currentAnimationDuration = 0.0f;
-      }
-      string state = ValueOf("state", line);
-      currentState = state;
-
-      std::transform(currentState.begin(), currentState.end(), currentState.begin(), ::toupper);
-
-      if (legacySupport) {
-        string width = ValueOf("width", line);
-        string height = ValueOf("height", line);
-        //std::cout << "animation name in " << currentState << endl;
-
-        currentWidth = atoi(width.c_str());
-        currentHeight = atoi(height.c_str());
-      }
-
-      frameLists.push_back(FrameList());
-      frameAnimationIndex++;
-    }
-    else if (line.find("frame") != string::npos) {
-      string duration = ValueOf("duration", line);
-      float currentFrameDuration = (float)atof(duration.c_str());
-
-      int currentStartx = 0;
-      int currentStarty = 0;
-      float originX = 0;
-      float originY = 0;
-
-      if (legacySupport) {
-        string startx = ValueOf("startx", line);
-        string starty = ValueOf("starty", line);
-
-        currentStartx = atoi(startx.c_str());
-        currentStarty = atoi(starty.c_str());
-      }
-      else {
-        string x = ValueOf("x", line);
-        string y = ValueOf("y", line);
-        string w = ValueOf("w", line);
-        string h = ValueOf("h", line);
-        string ox = ValueOf("originx", line);
-        string oy = ValueOf("originy", line);
-
-        currentStartx = atoi(x.c_str());
-        currentStarty = atoi(y.c_str());
-        currentWidth = atoi(w.c_str());
-        currentHeight = atoi(h.c_str());
-        originX = (float)atoi(ox.c_str());
-        originY = (float)atoi(oy.c_str());
-      }
-
-      currentAnimationDuration += currentFrameDuration;
-
-      if (legacySupport) {
-        frameLists.at(frameAnimationIndex).Add(currentFrameDuration, IntRect(currentStartx, currentStarty, currentWidth, currentHeight));
-      }
-      else {
-        frameLists.at(frameAnimationIndex).Add(currentFrameDuration, IntRect(currentStartx, currentStarty, currentWidth, currentHeight), sf::Vector2f(originX, originY));
-      }
-    }
-    else if (line.find("point") != string::npos) {
-      string pointName = ValueOf("label", line);
-      string xStr = ValueOf("x", line);
-      string yStr = ValueOf("y", line);
+void Animation::Load()
+{
+  Reload();
+}
 
-      std::transform(pointName.begin(), pointName.end(), pointName.begin(), ::toupper);
+const FrameList& Animation::FindFrameList(const string& state) const {
+  static const FrameList empty;
 
-      int x = atoi(xStr.c_str());
-      int y = atoi(yStr.c_str());
+  auto iter = overrides.find(state);
 
-      frameLists[frameAnimationIndex].SetPoint(pointName, x, y);
-    }
+  if (iter != overrides.end()) {
+    return iter->second;
+  }
 
-    data = data.substr(endline + 1);
-  } while (endline > -1);
+  if (data) {
+    auto dataIter = data->animations.find(state);
 
-  // One more addAnimation to do if file is good
-  if (frameAnimationIndex >= 0) {
-    animations.insert(std::make_pair(currentState, frameLists.at(frameAnimationIndex)));
+    if (dataIter != data->animations.end()) {
+      return dataIter->second;
+    }
   }
-}
 
-void Animation::Load()
-{
-  Reload();
+  return empty;
 }
 
-string Animation::ValueOf(string _key, string _line) {
-  int keyIndex = (int)_line.find(_key);
-  // assert(keyIndex > -1 && "Key was not found in .animation file.");
-  string s = _line.substr(keyIndex + _key.size() + 2);
-  return s.substr(0, s.find("\""));
+const bool Animation::HasFrameList(const string& state) const {
+  return overrides.find(state) != overrides.end() || (data && data->animations.find(state) != data->animations.end());
 }
 
 void Animation::Refresh(sf::Sprite& target) {
@@ -167,18 +82,19 @@ void Animation::Refresh(sf::Sprite& target) {
 void Animation::Update(float elapsed, sf::Sprite& target, double playbackSpeed) {
   progress += elapsed * (float)std::fabs(playbackSpeed);
 
-  std::string stateNow = currAnimation;
+  // compare frame lists instead of copying the state name every frame
+  const FrameList* listNow = &FindFrameList(currAnimation);
 
-  animator(progress, target, animations[currAnimation]);
+  animator(progress, target, *listNow);
 
-  if(currAnimation != stateNow) {
+  if(&FindFrameList(currAnimation) != listNow) {
 	  // it was changed during a callback
 	  // apply new state to target on same frame
-	  animator(0, target, animations[currAnimation]);
+	  animator(0, target, FindFrameList(currAnimation));
 	  progress = 0;
   }
 
-  const float duration = animations[currAnimation].GetTotalDuration();
+  const float duration = FindFrameList(currAnimation).GetTotalDuration();
 
   if(duration <= 0.f) return;
 
@@ -195,21 +111,22 @@ void Animation::SyncTime(float newTime)
 
 void Animation::SetFrame(int frame, sf::Sprite& target)
 {
-  if(path.empty() || animations.empty() || animations.find(currAnimation) == animations.end()) return;
+  if(path.empty() || !HasFrameList(currAnimation)) return;
 
-  auto size = animations[currAnimation].GetFrameCount();
+  const FrameList& list = FindFrameList(currAnimation);
+  auto size = list.GetFrameCount();
 
   if (frame <= 0 || frame > size) {
     progress = 0.0f;
-    animator.SetFrame(int(size), target, animations[currAnimation]);
+    animator.SetFrame(int(size), target, list);
 
   }
   else {
-    animator.SetFrame(frame, target, animations[currAnimation]);
+    animator.SetFrame(frame, target, list);
     progress = 0.0f;
 
     while (frame) {
-      progress += animations[currAnimation].GetFrame(--frame).duration;
+      progress += list.GetFrame(--frame).duration;
     }
   }
 }
@@ -220,11 +137,14 @@ void Animation::SetAnimation(string state) {
 
    std::transform(state.begin(), state.end(), state.begin(), ::toupper);
 
-   auto pos = animations.find(state);
-
-   if (pos == animations.end()) {
+   if (!HasFrameList(state)) {
      //throw std::runtime_error(std::string("No animation found in file for " + currAnimation));
-     Logger::Log("No animation found in file for " + state);
+
+     // Some callers ask for the same missing state every frame. Say so once.
+     if (state != missingAnimation) {
+       missingAnimation = state;
+       BN_LOG(Warning, Animation, "No animation found in file for " + state);
+     }
    }
    else {
      currAnimation = state;
@@ -241,10 +161,10 @@ const std::string Animation::GetAnimationString() const
   return currAnimation;
 }
 
-FrameList & Animation::GetFrameList(std::string animation)
+const FrameList & Animation::GetFrameList(std::string animation)
 {
   std::transform(animation.begin(), animation.end(), animation.begin(), ::toupper);
-  return animations[animation];
+  return FindFrameList(animation);
 }
 
 Animation & Animation::operator<<(Animator::On rhs)
@@ -271,12 +191,12 @@ void Animation::operator<<(std::function<void()> onFinish)
 
 sf::Vector2f Animation::GetPoint(const std::string & pointName)
 {
-  auto point = pointName;
-  std::transform(point.begin(), point.end(), point.begin(), ::toupper);
-
-  auto res = animator.GetPoint(point);
+  return animator.GetPoint(pointName);
+}
 
-  return res;
+sf::Vector2f Animation::GetPoint(int pointID)
+{
+  return animator.GetPoint(pointID);
 }
 
 void Animation::OverrideAnimationFrames(const std::string& animation, std::list <OverrideFrame> data, std::string& uuid)
@@ -288,7 +208,7 @@ void Animation::OverrideAnimationFrames(const std::string& animation, std::list
     uuid = animation + "@" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count());
   }
 
-  this->animations.emplace(uuid, std::move(this->animations[animation].MakeNewFromOverrideData(data)));
+  this->overrides.emplace(uuid, FindFrameList(currentAnimation).MakeNewFromOverrideData(data));
 }
 
 void Animation::SyncAnimation(Animation & other)
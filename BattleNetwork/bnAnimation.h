@@ -6,6 +6,7 @@
 #include <iostream>
 
 #include "bnAnimator.h"
+#include "bnAnimationDataCache.h"
 
 using std::string;
 using std::to_string;
@@ -20,6 +21,8 @@ using std::to_string;
  * @brief Loads a FrameList from an animation file format and animates a sprite
  * 
  * Basically a wrapper around the animator that knows the possible animations.
+ * The frame lists are shared through the AnimationDataCache so copying an Animation
+ * or loading the same file again does not parse or copy any frames.
  * 
  * File format example:
  * 
@@ -74,14 +77,15 @@ public:
 
   ~Animation();
   /**
-   * @brief Reads file at path set by constructor, parses lines, and populates FrameList with data
+   * @brief Fetches the frame table for the path set by constructor from the AnimationDataCache
 
+     The file is only read and parsed the first time it is requested.
      Effectively same as calling Load()
    */
   void Reload();
  
   /**
- * @brief Reads file at path set by constructor, parses lines, and populates FrameList with data
+ * @brief Fetches the frame table for the path set by constructor from the AnimationDataCache
 
     Effectively same as calling Reload();
  */
@@ -135,10 +139,10 @@ public:
   /**
    * @brief Get the frame list corresponding to this animation state
    * @param animation name of the animation
-   * @return FrameList&
-   * @warning Make sure this animation exists otherwise could return an empty frame list or throw
+   * @return const FrameList& shared with every other animation loaded from the same file
+   * @warning Make sure this animation exists otherwise returns an empty frame list
    */
-  FrameList& GetFrameList(std::string animation);
+  const FrameList& GetFrameList(std::string animation);
 
   /**
    * @brief Append frame callback
@@ -169,22 +173,36 @@ public:
 
   sf::Vector2f GetPoint(const std::string& pointName);
 
+  /**
+   * @brief Get a point of the current frame by its interned ID @see FramePoints
+   * @param pointID
+   * @return (x,y) vector of point or (0,0) if no point found
+   */
+  sf::Vector2f GetPoint(int pointID);
+
   void OverrideAnimationFrames(const std::string& animation, std::list<OverrideFrame> data, std::string& uuid);
 
   void SyncAnimation(Animation& other);
 
 private:
   /**
-   * @brief Strips the key-value from a file format
-   * @param _key to look for value of
-   * @param _line string input
-   * @return value as string or empty string
+   * @brief Looks up a frame list in the overrides first and then the shared frame table
+   * @param state uppercase animation name
+   * @return the frame list or an empty frame list if no animation exists with this name
+   */
+  const FrameList& FindFrameList(const string& state) const;
+
+  /**
+   * @brief Query if either the overrides or the shared frame table has this animation
+   * @param state uppercase animation name
    */
-  string ValueOf(string _key, string _line);
+  const bool HasFrameList(const string& state) const;
 protected:
   Animator animator; /*!< Internal animator to delegate most of the work to */
   string path; /*!< Path to the animation file */
   string currAnimation; /*!< Name of the current animation state */
+  string missingAnimation; /*!< Last state requested that does not exist. Only logged once in a row. */
   float progress; /*!< Current progress of animation */
-  std::map<string, FrameList> animations; /*!< Dictionary of FrameLists read from file */
+  AnimationDataCache::Handle data; /*!< Shared, immutable frame table read from file */
+  std::map<string, FrameList> overrides; /*!< FrameLists generated by OverrideAnimationFrames() for this instance only */
 };
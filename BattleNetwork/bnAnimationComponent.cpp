@@ -107,6 +107,11 @@ sf::Vector2f AnimationComponent::GetPoint(const std::string & pointName)
   return animation.GetPoint(pointName);
 }
 
+sf::Vector2f AnimationComponent::GetPoint(int pointID)
+{
+  return animation.GetPoint(pointID);
+}
+
 void AnimationComponent::OverrideAnimationFrames(const std::string& animation, std::list<OverrideFrame> data, std::string & uuid)
 {
   this->animation.OverrideAnimationFrames(animation, data, uuid);
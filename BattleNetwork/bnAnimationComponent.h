@@ -119,6 +119,13 @@ public:
    * @return (x,y) vector of point or (0,0) if no point found
    */
   sf::Vector2f GetPoint(const std::string& pointName);
+
+  /**
+   * @brief Get the (x,y) coordinate of a point from the current frame
+   * @param pointID interned name of the point @see FramePoints
+   * @return (x,y) vector of point or (0,0) if no point found
+   */
+  sf::Vector2f GetPoint(int pointID);
   
   void OverrideAnimationFrames(const std::string& animation, std::list<OverrideFrame> data, std::string& uuid);
 
@@ -0,0 +1,117 @@
+#include <SFML/Graphics.hpp>
+using sf::IntRect;
+
+#include "bnAnimationDataCache.h"
+#include "bnAssetPack.h"
+#include "bnFileUtil.h"
+#include "bnLogger.h"
+#include "bnProfiler.h"
+
+#include <algorithm>
+
+AnimationDataCache& AnimationDataCache::GetInstance() {
+  static AnimationDataCache instance;
+  return instance;
+}
+
+AnimationDataCache::AnimationDataCache() {
+}
+
+AnimationDataCache::~AnimationDataCache() {
+  cache.clear();
+}
+
+AnimationDataCache::Handle AnimationDataCache::Load(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto iter = cache.find(path);
+
+  if (iter != cache.end()) {
+    return iter->second;
+  }
+
+  Handle data = std::make_shared<const AnimationData>(Parse(path));
+  cache.insert(std::make_pair(path, data));
+
+  return data;
+}
+
+void AnimationDataCache::Evict(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex);
+  cache.erase(path);
+}
+
+void AnimationDataCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  cache.clear();
+}
+
+AnimationData AnimationDataCache::Unpack(const AssetPack::Entry& entry) {
+  AnimationData res;
+
+  const AssetPack::AnimationRecord* animations = ASSETPACK.GetAnimations(entry);
+
+  for (uint32_t i = 0; i < entry.count; i++) {
+    const AssetPack::AnimationRecord& animation = animations[i];
+    const AssetPack::FrameRecord* frames = ASSETPACK.GetFrames(animation);
+    FrameList frameList;
+
+    for (uint32_t j = 0; j < animation.frameCount; j++) {
+      const AssetPack::FrameRecord& frame = frames[j];
+      IntRect rect(frame.x, frame.y, frame.w, frame.h);
+
+      if (frame.applyOrigin) {
+        frameList.Add(frame.duration, rect, sf::Vector2f(frame.originX, frame.originY));
+      }
+      else {
+        frameList.Add(frame.duration, rect);
+      }
+
+      const AssetPack::PointRecord* points = ASSETPACK.GetPoints(frame);
+
+      for (uint32_t k = 0; k < frame.pointCount; k++) {
+        frameList.SetPoint(ASSETPACK.GetString(points[k].label), points[k].x, points[k].y);
+      }
+    }
+
+    res.animations.insert(std::make_pair(std::string(ASSETPACK.GetString(animation.state)), std::move(frameList)));
+  }
+
+  return res;
+}
+
+AnimationData AnimationDataCache::Parse(const std::string& path) {
+  PROFILE_ZONE("Animations::Parse");
+
+  if (const AssetPack::Entry* entry = ASSETPACK.Find(path, AssetPack::EntryKind::animation)) {
+    return Unpack(*entry);
+  }
+
+  AnimationData res;
+  FrameList frameList;
+
+  auto onFrame = [&frameList](const AssetParser::Frame& frame) {
+    IntRect rect(frame.x, frame.y, frame.w, frame.h);
+
+    if (frame.applyOrigin) {
+      frameList.Add(frame.duration, rect, sf::Vector2f(frame.originX, frame.originY));
+    }
+    else {
+      frameList.Add(frame.duration, rect);
+    }
+  };
+
+  auto onPoint = [&frameList](std::string_view label, int x, int y) {
+    frameList.SetPoint(std::string(label), x, y);
+  };
+
+  auto onState = [&res, &frameList](const std::string& state) {
+    res.animations.insert(std::make_pair(state, std::move(frameList)));
+    frameList = FrameList();
+  };
+
+  std::string data = FileUtil::Read(path);
+  AssetParser::ParseAnimation(data, onFrame, onPoint, onState);
+
+  return res;
+}
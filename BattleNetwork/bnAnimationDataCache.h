@@ -0,0 +1,85 @@
+/*! \file bnAnimationDataCache.h */
+
+/*! \brief Singleton cache of parsed .animation files
+ *
+ * Every entity used to re-read and re-parse its .animation file when it was spawned.
+ * The cache parses each file once into an immutable frame table and hands out
+ * shared handles. Animation objects only own their playback state on top of the handle.
+ *
+ * Handles are reference counted so evicting a path does not invalidate animations still using it.
+ */
+
+#pragma once
+#include "bnAnimator.h"
+#include "bnAssetPack.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @struct AnimationData
+ * @author mav
+ * @date 16/10/26
+ * @brief Immutable frame table for one .animation file
+ */
+struct AnimationData {
+  std::map<std::string, FrameList> animations; /*!< Dictionary of FrameLists read from file */
+};
+
+class AnimationDataCache {
+public:
+  using Handle = std::shared_ptr<const AnimationData>;
+
+  /**
+   * @brief If this is the first call, initializes the cache.
+   * @return Returns reference to the animation data cache.
+   */
+  static AnimationDataCache& GetInstance();
+
+  /**
+   * @brief Returns the parsed frame table for the file at path. Parses the file on the first request.
+   * @param path Relative path to the application
+   * @return Shared handle to the frame table. Never null. Missing files yield an empty table.
+   */
+  Handle Load(const std::string& path);
+
+  /**
+   * @brief Drops the cached table for path. The next Load() will parse the file again.
+   * @param path Relative path to the application
+   */
+  void Evict(const std::string& path);
+
+  /**
+   * @brief Drops every cached table
+   */
+  void Clear();
+
+private:
+  AnimationDataCache();
+  ~AnimationDataCache();
+
+  /**
+   * @brief Reads file at path, parses lines, and populates a new frame table
+   *
+   * Uses the baked frame table from the asset pack when it is up to date with the file.
+   *
+   * @param path Relative path to the application
+   * @return AnimationData
+   */
+  AnimationData Parse(const std::string& path);
+
+  /**
+   * @brief Copies a baked frame table out of the asset pack
+   * @param entry Animation entry of the asset pack
+   * @return AnimationData
+   */
+  AnimationData Unpack(const AssetPack::Entry& entry);
+
+  std::mutex mutex; /*!< Animations may be loaded from the resource loading thread */
+  std::map<std::string, Handle> cache; /*!< path -> parsed frame table */
+};
+
+/*! \brief Shorthand to get instance of the cache */
+#define ANIMATIONS AnimationDataCache::GetInstance()
@@ -1,6 +1,10 @@
 #include "bnAnimator.h"
+#include "bnProfiler.h"
 
 #include <iostream>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 Animator::Animator() {
   onFinish = nullptr;
@@ -41,33 +45,73 @@ Animator::~Animator() {
   this->queuedOnFinish = nullptr;
 }
 
-void Animator::UpdateCurrentPoints(int frameIndex, FrameList& sequence) {
+int FramePoints::Intern(const std::string& name) {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, int> ids = { { "ORIGIN", FramePoints::ORIGIN } };
+
+  auto str = name;
+  std::transform(str.begin(), str.end(), str.begin(), ::toupper);
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto iter = ids.find(str);
+
+  if (iter != ids.end()) {
+    return iter->second;
+  }
+
+  int id = (int)ids.size();
+  ids.insert(std::make_pair(str, id));
+
+  return id;
+}
+
+void Animator::UpdateCurrentPoints(int frameIndex, const FrameList& sequence) {
   if (sequence.frames.size() <= frameIndex) return;
 
+  // Assignment reuses our capacity so steady-state playback does not allocate
   currentPoints = sequence.frames[frameIndex].points;
 }
 
-void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequence) {
+void Animator::MergeQueuedCallbacks() {
+  // Splices the queued nodes over instead of copying them
+  callbacks.merge(queuedCallbacks);
+  queuedCallbacks.clear();
+
+  onetimeCallbacks.merge(queuedOnetimeCallbacks);
+  queuedOnetimeCallbacks.clear();
+
+  if (queuedOnFinish) {
+    onFinish = queuedOnFinish;
+    queuedOnFinish = nullptr;
+  }
+}
+
+void Animator::operator() (float progress, sf::Sprite& target, const FrameList& sequence) {
+  PROFILE_ZONE("Animator");
+
   float startProgress = progress;
 
+  const std::vector<Frame>& frames = sequence.frames;
+  const int count = (int)frames.size();
+
   // If we did not progress while in an update, do not merge the queues and ignore this request 
   // All we wish to do is re-adjust the origin if applicable
-  if (progress == 0 && sequence.frames.size()) {
-    auto iter = sequence.frames.begin();
+  if (progress == 0 && count) {
     int index = 1;
 
-    // If the playback mode is reverse, flip the frames
-    // and the index
+    // If the playback mode is reverse, start from the last frame
     if ((playbackMode & Mode::Reverse) == Mode::Reverse) {
-      iter = sequence.frames.end();
-      index = sequence.frames.size();
+      index = count;
     }
 
-    target.setTextureRect((*iter).subregion);
+    const Frame& frame = frames[index - 1];
+
+    target.setTextureRect(frame.subregion);
 
     // If applicable, update the origin
-    if ((*iter).applyOrigin) {
-      target.setOrigin((float)(*iter).origin.x, (float)(*iter).origin.y);
+    if (frame.applyOrigin) {
+      target.setOrigin((float)frame.origin.x, (float)frame.origin.y);
     }
 
     // animation index are base 1
@@ -82,7 +126,7 @@ void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequen
   // Set our flag to let callback additions go to the right queue  
   isUpdating = true;
 
-  if (sequence.frames.empty() || sequence.GetTotalDuration() == 0) {
+  if (frames.empty() || sequence.GetTotalDuration() == 0) {
     if (onFinish != nullptr) {
       // Fire the onFinish callback if available
       onFinish();
@@ -95,51 +139,40 @@ void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequen
     // All callbacks are in a valid state
     callbacksAreValid = true;
 
-    // Insert any queued callbacks into the callback list
-    callbacks.insert(queuedCallbacks.begin(), queuedCallbacks.end());
-    queuedCallbacks.clear();
-
-    // Insert any queued one-time callbacks into the one-time callback list
-    onetimeCallbacks.insert(queuedOnetimeCallbacks.begin(), queuedOnetimeCallbacks.end());
-    queuedOnetimeCallbacks.clear();
-
-    // Insert any queued onFinish callback into the onFinish callback
-    if (queuedOnFinish) {
-      onFinish = queuedOnFinish;
-      queuedOnFinish = nullptr;
-    }
+    // Insert any queued callbacks into the callback lists
+    MergeQueuedCallbacks();
 
     // End
     return;
   }
 
-  // We may modify the frame order, make a copy
-  std::vector<Frame> copy = sequence.frames;
+  // We walk the frames by position instead of copying and reversing the list.
+  // `reversed` flips the direction for Reverse playback and for each Bounce.
+  bool reversed = (playbackMode & Mode::Reverse) == Mode::Reverse;
+  int pos = 0;
 
-  // If the playback mode is reverse, flip the frames
-  if ((playbackMode & Mode::Reverse) == Mode::Reverse) {
-    reverse(copy.begin(), copy.end());
-  }
+  auto frameAt = [&frames, &reversed, count](int i) -> const Frame& {
+    return reversed ? frames[count - 1 - i] : frames[i];
+  };
 
   // frame index
   int index = 0;
 
-  // Iterator to the frame itself
-  std::vector<Frame>::const_iterator iter = copy.begin();
-
   // While there is time left in the progress loop
   while (startProgress != 0.f) {
+    const Frame& frame = frameAt(pos);
+
     // Increase the index
     index++;
 
     // Subtract from the progress
-    progress -= (*iter).duration;
+    progress -= frame.duration;
 
     // Must be <= and not <, to handle case (progress == frame.duration) correctly
     // We assume progress hits zero because we use it as a decrementing counter
     // We add a check to ensure the start progress wasn't also 0
     // If it did not start at zero, we know we came across the end of the animation
-    bool reachedLastFrame = &(*iter) == &copy.back() && startProgress != 0.f;
+    bool reachedLastFrame = pos == count - 1 && startProgress != 0.f;
 
     if (progress <= 0.f || reachedLastFrame) {
       std::map<int, std::function<void()>>::iterator callbackIter, callbackFind = this->callbacks.find(index);
@@ -156,11 +189,9 @@ void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequen
         // If the callback modified the first callbacks list, break
         if (!callbacksAreValid) break;
 
-        // Otherwise add the callback into the next loop queue
-        nextLoopCallbacks.insert(*callbackIter);
-
-        // Erase the callback so we don't fire again
-        callbackIter = callbacks.erase(callbackIter);
+        // Otherwise move the callback into the next loop queue so we don't fire again
+        auto fired = callbackIter++;
+        nextLoopCallbacks.insert(callbacks.extract(fired));
 
         // Find the callback at the given index b/c iterator will be invalidated
         callbackFind = callbacks.find(index);
@@ -173,8 +204,7 @@ void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequen
         }
 
         if (callbacksAreValid) {
-          nextLoopCallbacks.insert(*callbackIter);
-          callbackIter = callbacks.erase(callbackIter);
+          nextLoopCallbacks.insert(callbacks.extract(callbackIter));
         }
       }
 
@@ -203,24 +233,22 @@ void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequen
       }
 
       // If the playback mode was set to loop...
-      if ((playbackMode & Mode::Loop) == Mode::Loop && progress > 0.f && &(*iter) == &copy.back()) {
-        // But it was also set to bounce, reverse the list and start over
+      if ((playbackMode & Mode::Loop) == Mode::Loop && progress > 0.f && pos == count - 1) {
+        // But it was also set to bounce, reverse the direction and start over
         if ((playbackMode & Mode::Bounce) == Mode::Bounce) {
-          reverse(copy.begin(), copy.end());
-          iter = copy.begin();
-          iter++;
+          reversed = !reversed;
+
+          // Skip the frame we just bounced off of
+          pos = count > 1 ? 1 : 0;
         }
         else {
           // It was set only to loop, start from the beginning
-          iter = copy.begin();
+          pos = 0;
         }
 
-        // Clear any remaining callbacks
-        this->callbacks.clear();
-
         // Enqueue the callbacks for the next go around
-        this->callbacks = nextLoopCallbacks;
-        this->nextLoopCallbacks.clear();
+        this->callbacks.clear();
+        this->callbacks.swap(nextLoopCallbacks);
 
         callbacksAreValid = true;
 
@@ -228,11 +256,11 @@ void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequen
       }
 
       // Apply the frame to the sprite object
-      target.setTextureRect((*iter).subregion);
+      target.setTextureRect(frame.subregion);
 
       // If applicable, apply the origin too
-      if ((*iter).applyOrigin) {
-        target.setOrigin((float)(*iter).origin.x, (float)(*iter).origin.y);
+      if (frame.applyOrigin) {
+        target.setOrigin((float)frame.origin.x, (float)frame.origin.y);
       }
 
       UpdateCurrentPoints(index - 1, sequence);
@@ -241,16 +269,18 @@ void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequen
     }
 
     // If not finish, go to next frame
-    iter++;
+    pos++;
   }
 
   // If we prematurely ended the loop, update the sprite
-  if (iter != copy.end()) {
-    target.setTextureRect((*iter).subregion);
+  if (pos < count) {
+    const Frame& frame = frameAt(pos);
+
+    target.setTextureRect(frame.subregion);
 
     // If applicable, update the origin
-    if ((*iter).applyOrigin) {
-      target.setOrigin((float)(*iter).origin.x, (float)(*iter).origin.y);
+    if (frame.applyOrigin) {
+      target.setOrigin((float)frame.origin.x, (float)frame.origin.y);
     }
   }
 
@@ -265,16 +295,7 @@ void Animator::operator() (float progress, sf::Sprite& target, FrameList& sequen
   UpdateCurrentPoints(index - 1, sequence);
 
   // Merge queued callbacks
-  callbacks.insert(queuedCallbacks.begin(), queuedCallbacks.end());
-  queuedCallbacks.clear();
-
-  onetimeCallbacks.insert(queuedOnetimeCallbacks.begin(), queuedOnetimeCallbacks.end());
-  queuedOnetimeCallbacks.clear();
-
-  if (queuedOnFinish) {
-    onFinish = queuedOnFinish;
-    queuedOnFinish = nullptr;
-  }
+  MergeQueuedCallbacks();
 }
 
 
@@ -325,13 +346,27 @@ void Animator::operator<<(std::function<void()> finishNotifier)
 }
 
 const sf::Vector2f Animator::GetPoint(const std::string& pointName) {
-  auto str = pointName;
-  std::transform(str.begin(), str.end(), str.begin(), ::toupper);
-  if (currentPoints.find(str) == currentPoints.end()) {
-    Logger::Log("Could not find point in current sequence named " + str);
-    return sf::Vector2f();
+  const int id = FramePoints::Intern(pointName);
+
+  for (auto& point : currentPoints) {
+    if (point.first == id) {
+      return point.second;
+    }
   }
-  return currentPoints[str];
+
+  Logger::Log("Could not find point in current sequence named " + pointName);
+  return sf::Vector2f();
+}
+
+const sf::Vector2f Animator::GetPoint(int pointID) {
+  for (auto& point : currentPoints) {
+    if (point.first == pointID) {
+      return point.second;
+    }
+  }
+
+  Logger::Log("Could not find point in current sequence with ID " + std::to_string(pointID));
+  return sf::Vector2f();
 }
 
 void Animator::Clear() {
@@ -340,10 +375,10 @@ void Animator::Clear() {
   nextLoopCallbacks.clear(); callbacks.clear(); onetimeCallbacks.clear(); onFinish = nullptr; playbackMode = 0;
 }
 
-void Animator::SetFrame(int frameIndex, sf::Sprite & target, FrameList& sequence)
+void Animator::SetFrame(int frameIndex, sf::Sprite & target, const FrameList& sequence)
 {
   int index = 0;
-  for (Frame& frame : sequence.frames) {
+  for (const Frame& frame : sequence.frames) {
     index++;
 
     if (index == frameIndex) {
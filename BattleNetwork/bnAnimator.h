@@ -6,6 +6,7 @@
 #include <assert.h>
 #include <iostream>
 #include <list>
+#include <vector>
 
 #include "bnLogger.h"
 
@@ -14,6 +15,32 @@ struct OverrideFrame {
   double duration;
 };
 
+/**
+ * @class FramePoints
+ * @author mav
+ * @date 16/10/26
+ * @brief Interns frame point labels to integer IDs
+ * 
+ * Frames and animators store points by ID so looking up and copying points
+ * during playback does not compare or allocate strings.
+ */
+class FramePoints {
+public:
+  static const int ORIGIN = 0; /*!< Every frame has an ORIGIN point */
+
+  /**
+   * @brief Get the ID for a point label. Labels are case insensitive.
+   * @param name point label
+   * @return unique ID for this label
+   */
+  static int Intern(const std::string& name);
+};
+
+/**
+ * @brief List of (point ID, position) pairs
+ */
+using FramePointList = std::vector<std::pair<int, sf::Vector2f>>;
+
 /**
  * @struct Frame
  * @author mav
@@ -26,11 +53,11 @@ struct Frame {
   bool applyOrigin;
   sf::Vector2f origin;
   
-  std::map<std::string, sf::Vector2f> points;
+  FramePointList points;
 
   Frame(float duration, sf::IntRect subregion, bool applyOrigin, sf::Vector2f origin) 
   : duration(duration), subregion(subregion), applyOrigin(applyOrigin), origin(origin) {
-    points["ORIGIN"] = origin;
+    points.emplace_back(FramePoints::ORIGIN, origin);
   }
 
   Frame(const Frame& rhs) {
@@ -58,13 +85,13 @@ struct Frame {
     rhs.applyOrigin = false;
 
     origin = rhs.origin;
-    points = rhs.points;
+    points = std::move(rhs.points);
     rhs.points.clear();
     return *this;
   }
 
   Frame(Frame&& rhs) {
-    *this = rhs;
+    *this = std::move(rhs);
   }
 };
 
@@ -87,7 +114,7 @@ public:
     totalDuration = rhs.totalDuration;
   }
 
-  FrameList MakeNewFromOverrideData(std::list<OverrideFrame> data) {
+  FrameList MakeNewFromOverrideData(std::list<OverrideFrame> data) const {
     auto iter = data.begin();
 
     FrameList res;
@@ -132,23 +159,31 @@ public:
   * Will overwrite any other point with the same name in the frame - unique names only
   */
   void SetPoint(const std::string& name, int x, int y) {
-    auto str = name;
-    std::transform(str.begin(), str.end(), str.begin(), ::toupper);
-    frames[frames.size() - 1].points[name] = sf::Vector2f(float(x), float(y));
+    const int id = FramePoints::Intern(name);
+    auto& points = frames[frames.size() - 1].points;
+
+    for (auto& point : points) {
+      if (point.first == id) {
+        point.second = sf::Vector2f(float(x), float(y));
+        return;
+      }
+    }
+
+    points.emplace_back(id, sf::Vector2f(float(x), float(y)));
   }
 
   /**
  * @brief Get the total number of frames in this list
  * @return const unsigned int
  */
-  const size_t GetFrameCount() { return this->frames.size(); }
+  const size_t GetFrameCount() const { return this->frames.size(); }
 
   /**
   * @brief Get the frame data at the given index
   * @param index of the frame in the list (base 0)
   * @return const Frame immutable
   */
-  const Frame& GetFrame(const int index) { return this->frames[index]; }
+  const Frame& GetFrame(const int index) const { return this->frames[index]; }
 
   /**
    * @brief Get the total duration for the list of frames
@@ -182,7 +217,7 @@ private:
   std::map<int, std::function<void()>> queuedCallbacks; /*!< used for adding new callbacks while updating */
   std::map<int, std::function<void()>> queuedOnetimeCallbacks; /*!< adding new one-time callbacks in update */
   
-  std::map<std::string, sf::Vector2f> currentPoints;
+  FramePointList currentPoints; /*!< Points of the last applied frame. Capacity is reused between frames. */
   
   std::function<void()> onFinish; /*!< special callback that fires when the animation is completed */
   std::function<void()> queuedOnFinish; /*!< Queues onFinish callback when used in the middle of update */
@@ -192,7 +227,12 @@ private:
   bool isUpdating; /*!< Flag if in the middle of update */
   bool callbacksAreValid; /*!< Flag for queues. If false, all added callbacks are discarded. */
   
-  void UpdateCurrentPoints(int frameIndex, FrameList& sequence);
+  void UpdateCurrentPoints(int frameIndex, const FrameList& sequence);
+
+  /**
+   * @brief Moves callbacks added during an update into the active callback lists
+   */
+  void MergeQueuedCallbacks();
 
 public:
   inline static const std::function<void()> NoCallback = [](){};
@@ -257,6 +297,13 @@ public:
   char GetMode() { return playbackMode;  }
   
   const sf::Vector2f GetPoint(const std::string& pointName);
+
+  /**
+   * @brief Get a point of the current frame by its interned ID @see FramePoints
+   * @param pointID
+   * @return (x,y) vector of point or (0,0) if no point found
+   */
+  const sf::Vector2f GetPoint(int pointID);
   
   /**
    * @brief Clears all callback functors
@@ -269,7 +316,7 @@ public:
    * @param target sprite to apply frames to
    * @param sequence list of frames
    */
-  void operator() (float progress, sf::Sprite& target, FrameList& sequence);
+  void operator() (float progress, sf::Sprite& target, const FrameList& sequence);
   
   /**
    * @brief Applies a callback
@@ -297,5 +344,5 @@ public:
    * @param target sprite to apply frame to
    * @param sequence frame is pulled from list using index
    */
-  void SetFrame(int frameIndex, sf::Sprite& target, FrameList& sequence);
+  void SetFrame(int frameIndex, sf::Sprite& target, const FrameList& sequence);
 };
@@ -8,6 +8,7 @@
 #include "bnTextureResourceManager.h"
 
 Artifact::Artifact(Field* _field) {
+  Tag<Artifact>(this);
   this->SetField(_field);
   this->SetTeam(Team::UNKNOWN);
   this->SetPassthrough(true);
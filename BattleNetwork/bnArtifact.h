@@ -1,5 +1,6 @@
 #pragma once
 #include "bnEntity.h"
+#include "bnEntityPool.h"
 using sf::Texture;
 
 /**
@@ -11,6 +12,12 @@ public:
   Artifact(Field* _field);
   virtual ~Artifact();
 
+  /**
+   * @brief Hit effects and explosions are short lived. Their memory is recycled by EntityPool.
+   */
+  static void* operator new(std::size_t size) { return EntityPool::Allocate(size); }
+  static void operator delete(void* ptr, std::size_t size) { EntityPool::Free(ptr, size); }
+
   virtual void OnUpdate(float _elapsed) = 0;
   virtual void OnDelete() { }
   virtual void Update(float _elapsed) final;
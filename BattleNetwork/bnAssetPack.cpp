@@ -0,0 +1,478 @@
+#include "bnAssetPack.h"
+#include "bnFileUtil.h"
+#include "bnLineTokenizer.h"
+#include "bnLogger.h"
+
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+
+namespace {
+  const char* DEFAULT_PACK_PATH = "resources/assets.pack";
+
+  const size_t RECORD_SIZES[AssetPack::SECTION_COUNT] = {
+    sizeof(AssetPack::Entry),
+    sizeof(AssetPack::AnimationRecord),
+    sizeof(AssetPack::FrameRecord),
+    sizeof(AssetPack::PointRecord),
+    sizeof(AssetPack::ChipRecord),
+    sizeof(AssetPack::RecipeRecord),
+    sizeof(AssetPack::StepRecord),
+    1, // STRINGS
+    1  // BLOBS
+  };
+
+  enum : char { UNCHECKED = 0, FRESH, STALE };
+}
+
+AssetPack& AssetPack::GetInstance() {
+  static AssetPack instance;
+  return instance;
+}
+
+uint64_t AssetPack::Hash(std::string_view data) {
+  uint64_t hash = 14695981039346656037ull;
+
+  for (char c : data) {
+    hash ^= (unsigned char)c;
+    hash *= 1099511628211ull;
+  }
+
+  return hash;
+}
+
+AssetPack::AssetPack() : size(0), header(nullptr) {
+  Open(DEFAULT_PACK_PATH);
+}
+
+AssetPack::~AssetPack() {
+}
+
+bool AssetPack::Open(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  buffer.reset();
+  size = 0;
+  header = nullptr;
+  verified.clear();
+
+  sf::FileInputStream in;
+
+  if (!in.open(path) || in.getSize() < (sf::Int64)sizeof(Header)) {
+    return false;
+  }
+
+  size_t length = (size_t)in.getSize();
+  std::unique_ptr<uint64_t[]> data(new uint64_t[(length + 7) / 8]);
+
+  if (in.read(data.get(), (sf::Int64)length) != (sf::Int64)length) {
+    Logger::Log("Asset pack " + path + " could not be read. Using text files.");
+    return false;
+  }
+
+  const Header* candidate = reinterpret_cast<const Header*>(data.get());
+
+  if (std::memcmp(candidate->magic, MAGIC, sizeof(MAGIC)) != 0 || candidate->version != VERSION) {
+    Logger::Log("Asset pack " + path + " is not version " + std::to_string(VERSION) + ". Using text files.");
+    return false;
+  }
+
+  for (unsigned i = 0; i < SECTION_COUNT; i++) {
+    const SectionRecord& section = candidate->sections[i];
+
+    if (section.offset % 8 != 0 || (size_t)section.offset + (size_t)section.count * RECORD_SIZES[i] > length) {
+      Logger::Log("Asset pack " + path + " is corrupt. Using text files.");
+      return false;
+    }
+  }
+
+  buffer = std::move(data);
+  size = length;
+  header = candidate;
+  verified.resize(header->sections[ENTRIES].count, UNCHECKED);
+
+  Logger::Log("Loaded asset pack " + path + " with " + std::to_string(verified.size()) + " entries");
+
+  return true;
+}
+
+bool AssetPack::IsOpen() const {
+  return header != nullptr;
+}
+
+const AssetPack::Entry* AssetPack::Find(const std::string& path, EntryKind kind) {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (!header) return nullptr;
+
+  const Entry* begin = Table<Entry>(ENTRIES);
+  const Entry* end = begin + header->sections[ENTRIES].count;
+
+  const Entry* entry = std::lower_bound(begin, end, path, [this](const Entry& e, const std::string& key) {
+    return key.compare(GetString(e.path)) > 0;
+  });
+
+  if (entry == end || path != GetString(entry->path) || entry->kind != kind) {
+    return nullptr;
+  }
+
+  char& state = verified[entry - begin];
+
+  if (state == UNCHECKED) {
+    std::string source = FileUtil::Read(path);
+
+    // Shipping only the pack is allowed. Otherwise the text file has the final say.
+    state = (source.empty() || Hash(source) == entry->hash) ? FRESH : STALE;
+
+    if (state == STALE) {
+      Logger::Log("Asset pack entry " + path + " is stale. Parsing text file.");
+    }
+  }
+
+  return state == FRESH ? entry : nullptr;
+}
+
+const AssetPack::AnimationRecord* AssetPack::GetAnimations(const Entry& entry) const {
+  return Table<AnimationRecord>(ANIMATIONS) + entry.first;
+}
+
+const AssetPack::FrameRecord* AssetPack::GetFrames(const AnimationRecord& animation) const {
+  return Table<FrameRecord>(FRAMES) + animation.firstFrame;
+}
+
+const AssetPack::PointRecord* AssetPack::GetPoints(const FrameRecord& frame) const {
+  return Table<PointRecord>(POINTS) + frame.firstPoint;
+}
+
+const AssetPack::ChipRecord* AssetPack::GetChips(const Entry& entry) const {
+  return Table<ChipRecord>(CHIPS) + entry.first;
+}
+
+const AssetPack::RecipeRecord* AssetPack::GetRecipes(const Entry& entry) const {
+  return Table<RecipeRecord>(RECIPES) + entry.first;
+}
+
+const AssetPack::StepRecord* AssetPack::GetSteps(const RecipeRecord& recipe) const {
+  return Table<StepRecord>(STEPS) + recipe.firstStep;
+}
+
+std::string_view AssetPack::GetBlob(const Entry& entry) const {
+  return std::string_view(Table<char>(BLOBS) + entry.first, entry.count);
+}
+
+const char* AssetPack::GetString(uint32_t offset) const {
+  return Table<char>(STRINGS) + offset;
+}
+
+// AssetParser
+
+void AssetParser::ParseAnimation(std::string_view text,
+  const std::function<void(const Frame&)>& onFrame,
+  const std::function<void(std::string_view label, int x, int y)>& onPoint,
+  const std::function<void(const std::string& state)>& onState) {
+  std::string currentState;
+  bool hasState = false;
+  bool hasFrame = false; /* the current state has a frame for points to go on */
+  int currentWidth = 0;
+  int currentHeight = 0;
+  bool legacySupport = false;
+
+  LineTokenizer reader(text);
+
+  while (reader.Next()) {
+    std::string_view tag = reader.Tag();
+
+    // NOTE: Support older animation files until we upgrade completely...
+    if (reader.Has("VERSION")) {
+      if (reader.Value("VERSION") == "1.0") legacySupport = true;
+    }
+    else if (tag == "animation") {
+      if (hasState) {
+        onState(currentState);
+        hasFrame = false;
+      }
+
+      currentState = std::string(reader.Value("state"));
+      hasState = true;
+
+      std::transform(currentState.begin(), currentState.end(), currentState.begin(), ::toupper);
+
+      if (legacySupport) {
+        currentWidth = reader.IntValue("width");
+        currentHeight = reader.IntValue("height");
+      }
+    }
+    else if (tag == "frame") {
+      Frame frame{};
+      frame.duration = reader.FloatValue("duration");
+
+      if (legacySupport) {
+        frame.x = reader.IntValue("startx");
+        frame.y = reader.IntValue("starty");
+        frame.w = currentWidth;
+        frame.h = currentHeight;
+      }
+      else {
+        frame.x = reader.IntValue("x");
+        frame.y = reader.IntValue("y");
+        frame.w = currentWidth = reader.IntValue("w");
+        frame.h = currentHeight = reader.IntValue("h");
+        frame.originX = (float)reader.IntValue("originx");
+        frame.originY = (float)reader.IntValue("originy");
+        frame.applyOrigin = true;
+      }
+
+      onFrame(frame);
+      hasFrame = true;
+    }
+    else if (tag == "point" && hasFrame) {
+      onPoint(reader.Value("label"), reader.IntValue("x"), reader.IntValue("y"));
+    }
+  }
+
+  // One more state to close if the file is good
+  if (hasState) {
+    onState(currentState);
+  }
+}
+
+void AssetParser::ParseChipLibrary(std::string_view text, const std::function<void(const Chip&)>& onChip) {
+  // Lines beginning with pound '#' are comments and are skipped by the tokenizer
+  LineTokenizer reader(text);
+
+  while (reader.Next()) {
+    if (reader.Tag() != "Chip") continue;
+
+    Chip chip{};
+    chip.cardIndex = reader.IntValue("cardIndex");
+    chip.iconIndex = reader.IntValue("iconIndex");
+    chip.damage = reader.IntValue("damage");
+    chip.rarity = reader.IntValue("rarity");
+    chip.name = reader.Value("name");
+    chip.desc = reader.Value("desc");
+    chip.verbose = reader.Value("verbose", "This chip does not have extra information.");
+    chip.type = reader.Value("type");
+
+    // Codes are delimited by ',' and may contain white space
+    std::string_view codes = reader.Value("codes");
+    size_t start = 0;
+
+    while (start <= codes.size()) {
+      size_t comma = codes.find(',', start);
+
+      if (comma == std::string_view::npos) {
+        comma = codes.size();
+      }
+
+      std::string_view token = codes.substr(start, comma - start);
+      start = comma + 1;
+
+      auto code = std::find_if(token.begin(), token.end(), [](char c) { return !isspace((unsigned char)c); });
+
+      // For every code, report one chip
+      if (code == token.end())
+        continue;
+
+      chip.code = *code;
+      onChip(chip);
+    }
+  }
+}
+
+void AssetParser::ParseProgramAdvance(std::string_view text, const std::function<void(const Recipe&)>& onRecipe) {
+  Recipe recipe{};
+  bool hasRecipe = false;
+
+  auto closeRecipe = [&]() {
+    if (recipe.steps.size() > 1) {
+      onRecipe(recipe);
+    }
+    else {
+      Logger::Log("Error. PA \"" + std::string(recipe.name) + "\": only has 1 required chip for recipe. PA's must have 2 or more chips. Skipping entry.");
+    }
+
+    recipe.steps.clear();
+  };
+
+  // Lines beginning with pound '#' are comments and are skipped by the tokenizer
+  LineTokenizer reader(text);
+
+  while (reader.Next()) {
+    std::string_view tag = reader.Tag();
+
+    if (tag == "PA") {
+      if (!recipe.steps.empty()) closeRecipe();
+
+      recipe.name = reader.Value("name");
+      recipe.damage = (unsigned)reader.IntValue("damage");
+      recipe.icon = (unsigned)reader.IntValue("iconIndex");
+      recipe.type = reader.Value("type");
+      hasRecipe = true;
+    }
+    else if (tag == "Chip") {
+      std::string_view code = reader.Value("code");
+      recipe.steps.push_back({ reader.Value("name"), code.empty() ? '\0' : code[0] });
+    }
+  }
+
+  if (hasRecipe || !recipe.steps.empty()) {
+    closeRecipe();
+  }
+}
+
+// AssetPackWriter
+
+void AssetPackWriter::AddAnimation(const std::string& path, std::string_view text) {
+  uint32_t firstAnimation = (uint32_t)animations.size();
+  uint32_t frameStart = (uint32_t)frames.size();
+
+  auto onFrame = [&](const AssetParser::Frame& frame) {
+    AssetPack::FrameRecord record{};
+    record.duration = frame.duration;
+    record.firstPoint = (uint32_t)points.size();
+    record.x = frame.x;
+    record.y = frame.y;
+    record.w = frame.w;
+    record.h = frame.h;
+    record.originX = frame.originX;
+    record.originY = frame.originY;
+    record.applyOrigin = frame.applyOrigin ? 1 : 0;
+
+    frames.push_back(record);
+  };
+
+  auto onPoint = [&](std::string_view label, int x, int y) {
+    points.push_back({ Intern(label), x, y });
+    frames.back().pointCount++;
+  };
+
+  auto onState = [&](const std::string& state) {
+    animations.push_back({ Intern(state), frameStart, (uint32_t)frames.size() - frameStart });
+    frameStart = (uint32_t)frames.size();
+  };
+
+  AssetParser::ParseAnimation(text, onFrame, onPoint, onState);
+
+  // Frames without any state are dropped, same as the text loader
+  frames.resize(frameStart);
+
+  AddEntry(path, AssetPack::EntryKind::animation, firstAnimation, (uint32_t)animations.size() - firstAnimation, text);
+}
+
+void AssetPackWriter::AddChipLibrary(const std::string& path, std::string_view text) {
+  uint32_t first = (uint32_t)chips.size();
+
+  AssetParser::ParseChipLibrary(text, [&](const AssetParser::Chip& chip) {
+    AssetPack::ChipRecord record{};
+    record.cardIndex = chip.cardIndex;
+    record.iconIndex = chip.iconIndex;
+    record.damage = chip.damage;
+    record.rarity = chip.rarity;
+    record.name = Intern(chip.name);
+    record.desc = Intern(chip.desc);
+    record.verbose = Intern(chip.verbose);
+    record.type = Intern(chip.type);
+    record.code = (unsigned char)chip.code;
+
+    chips.push_back(record);
+  });
+
+  AddEntry(path, AssetPack::EntryKind::chipLibrary, first, (uint32_t)chips.size() - first, text);
+}
+
+void AssetPackWriter::AddProgramAdvance(const std::string& path, std::string_view text) {
+  uint32_t first = (uint32_t)recipes.size();
+
+  AssetParser::ParseProgramAdvance(text, [&](const AssetParser::Recipe& recipe) {
+    AssetPack::RecipeRecord record{};
+    record.name = Intern(recipe.name);
+    record.damage = recipe.damage;
+    record.icon = recipe.icon;
+    record.type = Intern(recipe.type);
+    record.firstStep = (uint32_t)steps.size();
+    record.stepCount = (uint32_t)recipe.steps.size();
+
+    for (auto& step : recipe.steps) {
+      steps.push_back({ Intern(step.name), (uint32_t)(unsigned char)step.code });
+    }
+
+    recipes.push_back(record);
+  });
+
+  AddEntry(path, AssetPack::EntryKind::programAdvance, first, (uint32_t)recipes.size() - first, text);
+}
+
+void AssetPackWriter::AddBlob(const std::string& path, std::string_view data) {
+  uint32_t first = (uint32_t)blobs.size();
+  blobs.append(data.data(), data.size());
+
+  AddEntry(path, AssetPack::EntryKind::blob, first, (uint32_t)data.size(), data);
+}
+
+uint32_t AssetPackWriter::Intern(std::string_view str) {
+  auto iter = interned.find(str);
+
+  if (iter != interned.end()) {
+    return iter->second;
+  }
+
+  uint32_t offset = (uint32_t)strings.size();
+  strings.append(str.data(), str.size());
+  strings.push_back('\0');
+
+  interned.insert(std::make_pair(std::string(str), offset));
+
+  return offset;
+}
+
+void AssetPackWriter::AddEntry(const std::string& path, AssetPack::EntryKind kind, uint32_t first, uint32_t count, std::string_view text) {
+  entries.push_back({ Intern(path), kind, first, count, AssetPack::Hash(text) });
+}
+
+bool AssetPackWriter::Write(const std::string& path) {
+  // Sort by path so the reader can binary search
+  std::sort(entries.begin(), entries.end(), [this](const AssetPack::Entry& a, const AssetPack::Entry& b) {
+    return std::strcmp(strings.c_str() + a.path, strings.c_str() + b.path) < 0;
+  });
+
+  // Duplicate entries would make lookups ambiguous. Keep the first.
+  entries.erase(std::unique(entries.begin(), entries.end(), [](const AssetPack::Entry& a, const AssetPack::Entry& b) {
+    return a.path == b.path;
+  }), entries.end());
+
+  AssetPack::Header header{};
+  std::memcpy(header.magic, AssetPack::MAGIC, sizeof(header.magic));
+  header.version = AssetPack::VERSION;
+
+  std::string out(sizeof(AssetPack::Header), '\0');
+
+  auto appendSection = [&out, &header](AssetPack::Section section, const void* data, size_t bytes, size_t count) {
+    out.resize((out.size() + 7) & ~size_t(7), '\0');
+    header.sections[section] = { (uint32_t)out.size(), (uint32_t)count };
+    out.append(reinterpret_cast<const char*>(data), bytes);
+  };
+
+  appendSection(AssetPack::ENTRIES, entries.data(), entries.size() * sizeof(AssetPack::Entry), entries.size());
+  appendSection(AssetPack::ANIMATIONS, animations.data(), animations.size() * sizeof(AssetPack::AnimationRecord), animations.size());
+  appendSection(AssetPack::FRAMES, frames.data(), frames.size() * sizeof(AssetPack::FrameRecord), frames.size());
+  appendSection(AssetPack::POINTS, points.data(), points.size() * sizeof(AssetPack::PointRecord), points.size());
+  appendSection(AssetPack::CHIPS, chips.data(), chips.size() * sizeof(AssetPack::ChipRecord), chips.size());
+  appendSection(AssetPack::RECIPES, recipes.data(), recipes.size() * sizeof(AssetPack::RecipeRecord), recipes.size());
+  appendSection(AssetPack::STEPS, steps.data(), steps.size() * sizeof(AssetPack::StepRecord), steps.size());
+  appendSection(AssetPack::STRINGS, strings.data(), strings.size(), strings.size());
+  appendSection(AssetPack::BLOBS, blobs.data(), blobs.size(), blobs.size());
+
+  std::memcpy(&out[0], &header, sizeof(header));
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+  if (!file.is_open()) {
+    return false;
+  }
+
+  file.write(out.data(), (std::streamsize)out.size());
+
+  return file.good();
+}
@@ -0,0 +1,295 @@
+/*! \file bnAssetPack.h */
+
+/*! \brief Precompiled binary pack of our text databases
+ *
+ * The AssetBake tool compiles every .animation file, the chip library, the PA recipes
+ * and the shader sources into one versioned file (resources/assets.pack).
+ * Frame tables and records have a fixed layout and every string lives in a single pool
+ * so loaders only copy values out of the pack instead of tokenizing text.
+ *
+ * Each entry remembers the content hash of the text file it was baked from.
+ * If the text file on disk no longer matches, the entry is considered stale
+ * and callers fall back to parsing the text file.
+ *
+ * The layout is position independent and 8-byte aligned so it can be memory mapped.
+ * We read the whole file into one buffer instead because Android assets are only
+ * reachable through sf::FileInputStream.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class AssetPack {
+public:
+  static constexpr char MAGIC[4] = { 'O', 'N', 'B', 'P' };
+  static constexpr uint32_t VERSION = 1; /*!< Bump when any record layout changes */
+
+  /*! \brief What kind of source file an entry was baked from */
+  enum class EntryKind : uint32_t {
+    animation = 0,
+    chipLibrary,
+    programAdvance,
+    blob
+  };
+
+  /*! \brief Tables in the pack. Records reference other tables by index */
+  enum Section : uint32_t {
+    ENTRIES = 0,
+    ANIMATIONS,
+    FRAMES,
+    POINTS,
+    CHIPS,
+    RECIPES,
+    STEPS,
+    STRINGS,
+    BLOBS,
+    SECTION_COUNT
+  };
+
+  struct SectionRecord {
+    uint32_t offset; /*!< Byte offset from the start of the pack */
+    uint32_t count;  /*!< Number of records. For STRINGS and BLOBS this is a byte count */
+  };
+
+  struct Header {
+    char magic[4];
+    uint32_t version;
+    SectionRecord sections[SECTION_COUNT];
+  };
+
+  /*! \brief One baked source file. Entries are sorted by path */
+  struct Entry {
+    uint32_t path;   /*!< String pool offset */
+    EntryKind kind;
+    uint32_t first;  /*!< First record in the kind's table. Byte offset for blobs */
+    uint32_t count;  /*!< Number of records. Byte length for blobs */
+    uint64_t hash;   /*!< FNV-1a hash of the source text */
+  };
+
+  /*! \brief One animation state of an .animation file */
+  struct AnimationRecord {
+    uint32_t state;  /*!< String pool offset. Already upper case */
+    uint32_t firstFrame;
+    uint32_t frameCount;
+  };
+
+  struct FrameRecord {
+    float duration;
+    int32_t x, y, w, h;
+    float originX, originY;
+    uint32_t applyOrigin; /*!< 0 for legacy VERSION="1.0" frames */
+    uint32_t firstPoint;
+    uint32_t pointCount;
+  };
+
+  struct PointRecord {
+    uint32_t label; /*!< String pool offset */
+    int32_t x, y;
+  };
+
+  /*! \brief One chip per code. Multi-code lines are expanded when baking */
+  struct ChipRecord {
+    int32_t cardIndex;
+    int32_t iconIndex;
+    int32_t damage;
+    int32_t rarity;
+    uint32_t code;
+    uint32_t name;    /*!< String pool offset */
+    uint32_t desc;    /*!< String pool offset */
+    uint32_t verbose; /*!< String pool offset */
+    uint32_t type;    /*!< String pool offset. Element name as written in the library */
+  };
+
+  struct RecipeRecord {
+    uint32_t name; /*!< String pool offset */
+    uint32_t icon;
+    uint32_t damage;
+    uint32_t type; /*!< String pool offset */
+    uint32_t firstStep;
+    uint32_t stepCount;
+  };
+
+  struct StepRecord {
+    uint32_t name; /*!< String pool offset */
+    uint32_t code;
+  };
+
+  /**
+   * @brief If this is the first call, opens resources/assets.pack if it exists.
+   * @return Returns reference to the asset pack.
+   */
+  static AssetPack& GetInstance();
+
+  /**
+   * @brief 64 bit FNV-1a hash used to detect stale entries
+   */
+  static uint64_t Hash(std::string_view data);
+
+  /**
+   * @brief Replaces the loaded pack with the file at path
+   * @return true if the file exists and is a pack of the current version
+   */
+  bool Open(const std::string& path);
+
+  /**
+   * @brief Query if a pack is loaded
+   */
+  bool IsOpen() const;
+
+  /**
+   * @brief Finds the entry baked from path
+   *
+   * The source file is hashed the first time an entry is requested.
+   * If the source exists and its hash differs, the entry is stale and nullptr is returned.
+   * If the source is missing the pack is trusted.
+   *
+   * @param path Relative path to the application e.g. resources/database/PA.txt
+   * @param kind Expected kind of the entry
+   * @return entry or nullptr if there is no fresh entry
+   */
+  const Entry* Find(const std::string& path, EntryKind kind);
+
+  const AnimationRecord* GetAnimations(const Entry& entry) const;
+  const FrameRecord* GetFrames(const AnimationRecord& animation) const;
+  const PointRecord* GetPoints(const FrameRecord& frame) const;
+  const ChipRecord* GetChips(const Entry& entry) const;
+  const RecipeRecord* GetRecipes(const Entry& entry) const;
+  const StepRecord* GetSteps(const RecipeRecord& recipe) const;
+  std::string_view GetBlob(const Entry& entry) const;
+  const char* GetString(uint32_t offset) const;
+
+private:
+  AssetPack();
+  ~AssetPack();
+
+  template<typename Record>
+  const Record* Table(Section section) const {
+    return reinterpret_cast<const Record*>(bytes() + header->sections[section].offset);
+  }
+
+  const char* bytes() const { return reinterpret_cast<const char*>(buffer.get()); }
+
+  std::unique_ptr<uint64_t[]> buffer; /*!< 8-byte aligned copy of the pack */
+  size_t size;
+  const Header* header;
+  std::vector<char> verified; /*!< Per entry: 0 unchecked, 1 fresh, 2 stale */
+  std::mutex mutex; /*!< Animations may be loaded from the resource loading thread */
+};
+
+/**
+ * @class AssetParser
+ * @author mav
+ * @date 16/10/26
+ * @brief The one reader of each text database format
+ *
+ * AnimationDataCache, ChipLibrary and PA use these when there is no fresh baked entry,
+ * and AssetPackWriter bakes from them, so the pack always matches what the text loaders produce.
+ * Views handed to the callbacks point into text and are only valid until the parser returns.
+ */
+class AssetParser {
+public:
+  struct Frame {
+    float duration;
+    int x, y, w, h;
+    bool applyOrigin; /*!< False for version 1.0 files, which have no origin */
+    float originX, originY;
+  };
+
+  struct Chip {
+    int cardIndex;
+    int iconIndex;
+    int damage;
+    int rarity;
+    char code;
+    std::string_view name;
+    std::string_view desc;
+    std::string_view verbose;
+    std::string_view type;
+  };
+
+  struct Step {
+    std::string_view name;
+    char code;
+  };
+
+  struct Recipe {
+    std::string_view name;
+    unsigned damage;
+    unsigned icon;
+    std::string_view type;
+    std::vector<Step> steps;
+  };
+
+  /**
+   * @brief Reads an .animation file
+   * @param onFrame called for each frame of the current state
+   * @param onPoint called for each point of the last frame. Points before a state's first frame are dropped.
+   * @param onState called once a state's frames and points were all reported, with the uppercase state name
+   *
+   * Frames before the first state belong to the first state.
+   */
+  static void ParseAnimation(std::string_view text,
+    const std::function<void(const Frame&)>& onFrame,
+    const std::function<void(std::string_view label, int x, int y)>& onPoint,
+    const std::function<void(const std::string& state)>& onState);
+
+  /**
+   * @brief Reads a chip library
+   * @param onChip called once per chip code listed in each entry
+   */
+  static void ParseChipLibrary(std::string_view text, const std::function<void(const Chip&)>& onChip);
+
+  /**
+   * @brief Reads the PA recipes
+   * @param onRecipe called for each recipe with 2 or more chips. Shorter recipes are logged and skipped.
+   */
+  static void ParseProgramAdvance(std::string_view text, const std::function<void(const Recipe&)>& onRecipe);
+};
+
+/**
+ * @class AssetPackWriter
+ * @author mav
+ * @date 16/10/26
+ * @brief Compiles text databases into the AssetPack format. Used by the AssetBake tool.
+ *
+ * Text is read with AssetParser, the same as the runtime loaders.
+ */
+class AssetPackWriter {
+public:
+  void AddAnimation(const std::string& path, std::string_view text);
+  void AddChipLibrary(const std::string& path, std::string_view text);
+  void AddProgramAdvance(const std::string& path, std::string_view text);
+  void AddBlob(const std::string& path, std::string_view data);
+
+  /**
+   * @brief Writes the pack
+   * @return false if the file could not be written
+   */
+  bool Write(const std::string& path);
+
+private:
+  uint32_t Intern(std::string_view str);
+  void AddEntry(const std::string& path, AssetPack::EntryKind kind, uint32_t first, uint32_t count, std::string_view text);
+
+  std::vector<AssetPack::Entry> entries;
+  std::vector<AssetPack::AnimationRecord> animations;
+  std::vector<AssetPack::FrameRecord> frames;
+  std::vector<AssetPack::PointRecord> points;
+  std::vector<AssetPack::ChipRecord> chips;
+  std::vector<AssetPack::RecipeRecord> recipes;
+  std::vector<AssetPack::StepRecord> steps;
+  std::string strings;
+  std::string blobs;
+  std::map<std::string, uint32_t, std::less<>> interned;
+};
+
+/*! \brief Shorthand to get instance of the asset pack */
+#define ASSETPACK AssetPack::GetInstance()
@@ -1,20 +1,87 @@
 #include "bnAudioResourceManager.h"
 #include "bnLogger.h"
+#include "bnTaskPool.h"
+#include "bnProfiler.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace {
+  /*! \brief Every hard-coded sample and where it lives on disk */
+  const std::pair<AudioType, const char*> SOURCE_PATHS[] = {
+    { AudioType::APPEAR, "resources/sfx/appear.ogg" },
+    { AudioType::AREA_GRAB, "resources/sfx/area_grab.ogg" },
+    { AudioType::AREA_GRAB_TOUCHDOWN, "resources/sfx/area_grab_touchdown.ogg" },
+    { AudioType::BUSTER_PEA, "resources/sfx/pew.ogg" },
+    { AudioType::BUSTER_CHARGED, "resources/sfx/buster_charged.ogg" },
+    { AudioType::BUSTER_CHARGING, "resources/sfx/buster_charging.ogg" },
+    { AudioType::BUBBLE_POP, "resources/sfx/bubble_pop.ogg" },
+    { AudioType::BUBBLE_SPAWN, "resources/sfx/bubble_spawn.ogg" },
+    { AudioType::GUARD_HIT, "resources/sfx/guard_hit.ogg" },
+    { AudioType::CANNON, "resources/sfx/cannon.ogg" },
+    { AudioType::COUNTER, "resources/sfx/counter.ogg" },
+    { AudioType::WIND, "resources/sfx/wind.ogg" },
+    { AudioType::CHIP_CANCEL, "resources/sfx/chip_cancel.ogg" },
+    { AudioType::CHIP_CHOOSE, "resources/sfx/chip_choose.ogg" },
+    { AudioType::CHIP_CONFIRM, "resources/sfx/chip_confirm.ogg" },
+    { AudioType::CHIP_DESC, "resources/sfx/chip_desc.ogg" },
+    { AudioType::CHIP_DESC_CLOSE, "resources/sfx/chip_desc_close.ogg" },
+    { AudioType::CHIP_SELECT, "resources/sfx/chip_select.ogg" },
+    { AudioType::CHIP_ERROR, "resources/sfx/chip_error.ogg" },
+    { AudioType::CUSTOM_BAR_FULL, "resources/sfx/custom_bar_full.ogg" },
+    { AudioType::CUSTOM_SCREEN_OPEN, "resources/sfx/chip_screen_open.ogg" },
+    { AudioType::ITEM_GET, "resources/sfx/item_get.ogg" },
+    { AudioType::DELETED, "resources/sfx/deleted.ogg" },
+    { AudioType::EXPLODE, "resources/sfx/explode_once.ogg" },
+    { AudioType::GUN, "resources/sfx/gun.ogg" },
+    { AudioType::HURT, "resources/sfx/hurt.ogg" },
+    { AudioType::PANEL_CRACK, "resources/sfx/panel_crack.ogg" },
+    { AudioType::PANEL_RETURN, "resources/sfx/panel_return.ogg" },
+    { AudioType::PAUSE, "resources/sfx/pause.ogg" },
+    { AudioType::PRE_BATTLE, "resources/sfx/pre_battle.ogg" },
+    { AudioType::RECOVER, "resources/sfx/recover.ogg" },
+    { AudioType::SPREADER, "resources/sfx/spreader.ogg" },
+    { AudioType::SWORD_SWING, "resources/sfx/sword_swing.ogg" },
+    { AudioType::TOSS_ITEM, "resources/sfx/toss_item.ogg" },
+    { AudioType::TOSS_ITEM_LITE, "resources/sfx/toss_item_lite.ogg" },
+    { AudioType::WAVE, "resources/sfx/wave.ogg" },
+    { AudioType::THUNDER, "resources/sfx/thunder.ogg" },
+    { AudioType::ELECPULSE, "resources/sfx/elecpulse.ogg" },
+    { AudioType::INVISIBLE, "resources/sfx/invisible.ogg" },
+    { AudioType::PA_ADVANCE, "resources/sfx/pa_advance.ogg" },
+    { AudioType::LOW_HP, "resources/sfx/low_hp.ogg" },
+    { AudioType::POINT, "resources/sfx/point.ogg" },
+    { AudioType::NEW_GAME, "resources/sfx/new_game.ogg" },
+    { AudioType::TEXT, "resources/sfx/text.ogg" },
+    { AudioType::SHINE, "resources/sfx/shine.ogg" },
+  };
+}
+
 
 AudioResourceManager& AudioResourceManager::GetInstance() {
   static AudioResourceManager instance;
   return instance;
 }
 
-AudioResourceManager::AudioResourceManager() {
+AudioResourceManager::AudioResourceManager() : streamLoader(1) {
   isEnabled = true;
+  fadeStart = fadeLength = 0;
 
   channels = new AudioResourceManager::Channel[NUM_OF_CHANNELS];
 
   for (int i = 0; i < NUM_OF_CHANNELS; i++) {
     channels[i].buffer = sf::Sound();
+    channels[i].priority = AudioPriority::LOWEST;
+    channels[i].type = AUDIO_TYPE_SIZE;
+    channels[i].startedAt = channels[i].endsAt = 0;
   }
 
+  for (int i = 0; i < AUDIO_TYPE_SIZE; i++) {
+    queued[i] = -1;
+  }
+
+  queue.reserve(AUDIO_TYPE_SIZE);
+
   sources = new sf::SoundBuffer[AudioType::AUDIO_TYPE_SIZE];
 
   for (int i = 0; i < AUDIO_TYPE_SIZE; i++) {
@@ -27,7 +94,7 @@ AudioResourceManager::AudioResourceManager() {
 
 AudioResourceManager::~AudioResourceManager() {
   // Stop playing everything 
-  stream.stop();
+  StopStream();
 
   for (int i = 0; i < NUM_OF_CHANNELS; i++) {
     channels[i].buffer.stop();
@@ -55,65 +122,33 @@ void AudioResourceManager::EnableAudio(bool status) {
 }
 
 void AudioResourceManager::LoadAllSources(std::atomic<int> &status) {
-  LoadSource(AudioType::APPEAR, "resources/sfx/appear.ogg"); status++;
-  LoadSource(AudioType::AREA_GRAB, "resources/sfx/area_grab.ogg"); status++;
-  LoadSource(AudioType::AREA_GRAB_TOUCHDOWN, "resources/sfx/area_grab_touchdown.ogg"); status++;
-  LoadSource(AudioType::BUSTER_PEA, "resources/sfx/pew.ogg"); status++;
-  LoadSource(AudioType::BUSTER_CHARGED, "resources/sfx/buster_charged.ogg"); status++;
-  LoadSource(AudioType::BUSTER_CHARGING, "resources/sfx/buster_charging.ogg"); status++;
-  LoadSource(AudioType::BUBBLE_POP, "resources/sfx/bubble_pop.ogg"); status++;
-  LoadSource(AudioType::BUBBLE_SPAWN, "resources/sfx/bubble_spawn.ogg"); status++;
-  LoadSource(AudioType::GUARD_HIT, "resources/sfx/guard_hit.ogg"); status++;
-  LoadSource(AudioType::CANNON, "resources/sfx/cannon.ogg"); status++;
-  LoadSource(AudioType::COUNTER, "resources/sfx/counter.ogg"); status++;
-  LoadSource(AudioType::WIND, "resources/sfx/wind.ogg"); status++;
-  LoadSource(AudioType::CHIP_CANCEL, "resources/sfx/chip_cancel.ogg"); status++;
-  LoadSource(AudioType::CHIP_CHOOSE, "resources/sfx/chip_choose.ogg"); status++;
-  LoadSource(AudioType::CHIP_CONFIRM, "resources/sfx/chip_confirm.ogg"); status++;
-  LoadSource(AudioType::CHIP_DESC, "resources/sfx/chip_desc.ogg"); status++;
-  LoadSource(AudioType::CHIP_DESC_CLOSE, "resources/sfx/chip_desc_close.ogg"); status++;
-  LoadSource(AudioType::CHIP_SELECT, "resources/sfx/chip_select.ogg"); status++;
-  LoadSource(AudioType::CHIP_ERROR, "resources/sfx/chip_error.ogg"); status++;
-  LoadSource(AudioType::CUSTOM_BAR_FULL, "resources/sfx/custom_bar_full.ogg"); status++;
-  LoadSource(AudioType::CUSTOM_SCREEN_OPEN, "resources/sfx/chip_screen_open.ogg"); status++;
-  LoadSource(AudioType::ITEM_GET, "resources/sfx/item_get.ogg"); status++;
-  LoadSource(AudioType::DELETED, "resources/sfx/deleted.ogg"); status++;
-  LoadSource(AudioType::EXPLODE, "resources/sfx/explode_once.ogg"); status++;
-  LoadSource(AudioType::GUN, "resources/sfx/gun.ogg"); status++;
-  LoadSource(AudioType::HURT, "resources/sfx/hurt.ogg"); status++;
-  LoadSource(AudioType::PANEL_CRACK, "resources/sfx/panel_crack.ogg"); status++;
-  LoadSource(AudioType::PANEL_RETURN, "resources/sfx/panel_return.ogg"); status++;
-  LoadSource(AudioType::PAUSE, "resources/sfx/pause.ogg"); status++;
-  LoadSource(AudioType::PRE_BATTLE, "resources/sfx/pre_battle.ogg"); status++;
-  LoadSource(AudioType::RECOVER, "resources/sfx/recover.ogg"); status++;
-  LoadSource(AudioType::SPREADER, "resources/sfx/spreader.ogg"); status++;
-  LoadSource(AudioType::SWORD_SWING, "resources/sfx/sword_swing.ogg"); status++;
-  LoadSource(AudioType::TOSS_ITEM, "resources/sfx/toss_item.ogg"); status++;
-  LoadSource(AudioType::TOSS_ITEM_LITE, "resources/sfx/toss_item_lite.ogg"); status++;
-  LoadSource(AudioType::WAVE, "resources/sfx/wave.ogg"); status++;
-  LoadSource(AudioType::THUNDER, "resources/sfx/thunder.ogg"); status++;
-  LoadSource(AudioType::ELECPULSE, "resources/sfx/elecpulse.ogg"); status++;
-  LoadSource(AudioType::INVISIBLE, "resources/sfx/invisible.ogg"); status++;
-  LoadSource(AudioType::PA_ADVANCE, "resources/sfx/pa_advance.ogg"); status++;
-  LoadSource(AudioType::LOW_HP, "resources/sfx/low_hp.ogg"); status++;
-  LoadSource(AudioType::POINT, "resources/sfx/point.ogg"); status++;
-  LoadSource(AudioType::NEW_GAME, "resources/sfx/new_game.ogg"); status++;
-  LoadSource(AudioType::TEXT, "resources/sfx/text.ogg"); status++;
-  LoadSource(AudioType::SHINE, "resources/sfx/shine.ogg"); status++;
+  for (auto& source : SOURCE_PATHS) {
+    LoadSource(source.first, source.second); status++;
+  }
+}
+
+void AudioResourceManager::QueueAllSources(TaskPool& pool, std::atomic<int> &status) {
+  // Each task writes to its own buffer so no locking is needed
+  for (auto& source : SOURCE_PATHS) {
+    AudioType type = source.first;
+    const char* path = source.second;
+
+    pool.Submit([this, type, path, &status]() {
+      LoadSource(type, path); status++;
+    });
+  }
 }
 
 void AudioResourceManager::LoadSource(AudioType type, const std::string& path) {
+  PROFILE_ZONE("Audio::LoadSource");
+
   if (!sources[type].loadFromFile(path)) {
 
-    Logger::GetMutex()->lock();
-    Logger::Logf("Failed loading audio: %s\n", path.c_str());
-    Logger::GetMutex()->unlock();
+    Logger::Logf(LogLevel::Warning, LogCategory::Audio, "Failed loading audio: %s", path.c_str());
 
   } else {
 
-    Logger::GetMutex()->lock();
-    Logger::Logf("Loaded audio: %s", path.c_str());
-    Logger::GetMutex()->unlock();
+    Logger::Logf(LogLevel::Info, LogCategory::Audio, "Loaded audio: %s", path.c_str());
   }
 }
 
@@ -124,110 +159,274 @@ int AudioResourceManager::Play(AudioType type, AudioPriority priority) {
     return -1;
   }
 
-  // Annoying sound check. Make sure duplicate sounds are played only by a given amount of offset from the last time it was played.
-  // This prevents amplitude stacking when duplicate sounds are played on the same frame...
-  // NOTE: an audio queue would be a better place for this check. Then play() those sounds that pass the queue filter.
-  if (priority != AudioPriority::HIGH) {
-    for (int i = 0; i < NUM_OF_CHANNELS; i++) {
-      if (channels[i].buffer.getBuffer() == &sources[type] && channels[i].buffer.getStatus() == sf::SoundSource::Status::Playing) {
-        auto howLongPlayed = channels[i].buffer.getPlayingOffset().asMilliseconds();
-        if (howLongPlayed <= AUDIO_DUPLICATES_ALLOWED_IN_X_MILLISECONDS) {
-          return -1;
-        }
-      }
-    }
+  // Many hits on one frame ask for the same sample. Only the loudest request matters.
+  int& index = queued[type];
+
+  if (index < 0) {
+    index = (int)queue.size();
+    queue.push_back({ type, priority });
+  }
+  else if (queue[index].priority < priority) {
+    queue[index].priority = priority;
+  }
+
+  return 0;
+}
+
+void AudioResourceManager::Flush() {
+  UpdateFade();
+
+  if (queue.empty()) return;
+
+  PROFILE_ZONE("Audio::Flush");
+
+  // Higher priorities claim channels first. Ties keep the order they were requested.
+  std::stable_sort(queue.begin(), queue.end(), [](const Request& a, const Request& b) {
+    return a.priority > b.priority;
+  });
+
+  sf::Int32 now = clock.getElapsedTime().asMilliseconds();
+
+  for (auto& request : queue) {
+    queued[request.type] = -1;
+
+    int i = FindChannel(request, now);
+
+    if (i < 0) continue;
+
+    Channel& channel = channels[i];
+
+    channel.buffer.stop();
+    channel.buffer.setBuffer(sources[request.type]);
+    channel.buffer.play();
+    channel.priority = request.priority;
+    channel.type = request.type;
+    channel.startedAt = now;
+    channel.endsAt = now + sources[request.type].getDuration().asMilliseconds();
   }
 
+  queue.clear();
+}
+
+int AudioResourceManager::FindChannel(const Request& request, sf::Int32 now) const {
+  auto isPlaying = [now](const Channel& c) { return c.type != AUDIO_TYPE_SIZE && now < c.endsAt; };
+
   // Priorities are LOWEST  (one at a time, if channel available),
   //                LOW     (any free channels),
   //                HIGH    (force a channel to play sound, but one at a time, and don't interrupt other high priorities),
   //                HIGHEST (force a channel to play sound always)
 
+  for (int i = 0; i < NUM_OF_CHANNELS; i++) {
+    const Channel& c = channels[i];
 
-  // Highest priority plays over anything that isn't like it
-  if (priority == AudioPriority::HIGHEST) {
-    for (int i = 0; i < NUM_OF_CHANNELS; i++) {
-      if ((sf::SoundBuffer*)channels[i].buffer.getBuffer() == &sources[type]) {
+    if (c.type != request.type || !isPlaying(c)) continue;
 
-      }
-      if (channels[i].buffer.getStatus() != sf::SoundSource::Status::Playing || channels[i].buffer.getBuffer() != &sources[type]) {
-        channels[i].buffer.stop();
-        channels[i].buffer.setBuffer(sources[type]);
-        channels[i].buffer.play();
-        channels[i].priority = priority;
-        return 0;
-      }
+    // Prevents amplitude stacking when duplicate sounds are played within a few frames
+    if (request.priority != AudioPriority::HIGH && now - c.startedAt <= AUDIO_DUPLICATES_ALLOWED_IN_X_MILLISECONDS) {
+      return -1;
     }
-  }
 
-  // For lowest priority or high priority sounds, scan and see if this sound is already playing...
-  // This step is also used as a pre-check for low priority sounds
-  if (priority == AudioPriority::LOWEST || priority == AudioPriority::HIGH) {
-    for (int i = 0; i < NUM_OF_CHANNELS; i++) {
-      if (channels[i].buffer.getStatus() == sf::SoundSource::Status::Playing) {
-        if ((sf::SoundBuffer*)channels[i].buffer.getBuffer() == &sources[type]) {
-          // Lowest priority or high priority sounds only play once 
-          return -1;
-        }
-      }
+    // Lowest priority or high priority sounds only play once
+    if (request.priority == AudioPriority::LOWEST || request.priority == AudioPriority::HIGH) {
+      return -1;
     }
   }
 
-  // Play sound based on priortiy rules
+  int steal = -1;
+
   for (int i = 0; i < NUM_OF_CHANNELS; i++) {
-    if (priority != AudioPriority::HIGH) {
-      if (channels[i].buffer.getStatus() != sf::SoundSource::Status::Playing) {
-        channels[i].buffer.setBuffer(sources[type]);
-        channels[i].buffer.play();
-        channels[i].priority = priority;
-        return 0;
-      }
+    const Channel& c = channels[i];
+
+    if (!isPlaying(c)) {
+      return i;
     }
-    else { // HIGH PRIORITY will not overwrite other HIGH priorities unless they have ended
-      bool canOverwrite = channels[i].priority < AudioPriority::HIGH 
-        ||(channels[i].priority == AudioPriority::HIGH && channels[i].buffer.getStatus() != sf::SoundSource::Status::Playing);
-      if (canOverwrite) {
-        channels[i].buffer.stop();
-        channels[i].buffer.setBuffer(sources[type]);
-        channels[i].buffer.play();
-        channels[i].priority = priority;
-        return 0;
-      }
+
+    bool canSteal = false;
+
+    if (request.priority == AudioPriority::HIGHEST) {
+      // Highest priority plays over anything that isn't like it
+      canSteal = c.type != request.type;
+    }
+    else if (request.priority == AudioPriority::HIGH) {
+      // HIGH PRIORITY will not overwrite other HIGH priorities unless they have ended
+      canSteal = c.priority < AudioPriority::HIGH;
+    }
+
+    if (!canSteal) continue;
+
+    // Steal the least important voice. Among equals, the one closest to finishing.
+    if (steal < 0 || c.priority < channels[steal].priority
+      || (c.priority == channels[steal].priority && c.endsAt < channels[steal].endsAt)) {
+      steal = i;
     }
   }
 
   // No free channel? Skip playing this sound.
-  return -1;
+  return steal;
+}
+
+void AudioResourceManager::PrefetchStream(const std::string& path) {
+  if (!isEnabled) return;
+
+  for (auto& track : prefetched) {
+    if (track->path == path) return;
+  }
+
+  if (prefetched.size() == MAX_PREFETCHED_STREAMS) {
+    // Closing a track that is still opening would race the loader
+    while (prefetched.front()->loading) {
+      std::this_thread::yield();
+    }
+
+    prefetched.erase(prefetched.begin());
+  }
+
+  auto track = std::make_shared<MusicTrack>();
+  track->path = path;
+  prefetched.push_back(track);
+
+  streamLoader.Submit([track]() {
+    PROFILE_ZONE("Audio::PrefetchStream");
+
+    track->opened = track->music.openFromFile(track->path);
+
+    if (!track->opened) {
+      Logger::Logf(LogLevel::Warning, LogCategory::Audio, "Failed prefetching music: %s", track->path.c_str());
+    }
+
+    track->loading = false;
+  });
+}
+
+std::shared_ptr<AudioResourceManager::MusicTrack> AudioResourceManager::TakeStream(const std::string& path) {
+  for (auto iter = prefetched.begin(); iter != prefetched.end(); iter++) {
+    if ((*iter)->path != path) continue;
+
+    auto track = *iter;
+    prefetched.erase(iter);
+
+    // Usually opened long ago. If not, this is no slower than opening it here.
+    while (track->loading) {
+      std::this_thread::yield();
+    }
+
+    return track;
+  }
+
+  PROFILE_ZONE("Audio::OpenStream");
+
+  BN_LOGF(Debug, Audio, "Music was not prefetched: %s", path.c_str());
+
+  auto track = std::make_shared<MusicTrack>();
+  track->path = path;
+  track->opened = track->music.openFromFile(path);
+  track->loading = false;
+
+  return track;
 }
 
 int AudioResourceManager::Stream(std::string path, bool loop, sf::Music::TimeSpan span) {
+  return StartStream(path, loop, span, 0.f);
+}
+
+int AudioResourceManager::CrossfadeStream(std::string path, float seconds, bool loop, sf::Music::TimeSpan span) {
+  return StartStream(path, loop, span, seconds);
+}
+
+int AudioResourceManager::StartStream(const std::string& path, bool loop, sf::Music::TimeSpan span, float fadeSeconds) {
   if (!isEnabled) { return -1; }
 
-  // stop previous stream if any 
-  stream.stop();
+  auto next = TakeStream(path);
 
-  if (!stream.openFromFile(path))
+  if (!next->opened) {
     return -1; // error
+  }
+
+  // Only one track fades out at a time
+  if (fadingOut) {
+    fadingOut->music.stop();
+    fadingOut.reset();
+  }
+
+  if (stream) {
+    if (fadeSeconds > 0.f) {
+      fadingOut = stream;
+    }
+    else {
+      // stop previous stream if any
+      stream->music.stop();
+    }
+  }
+
+  stream = next;
+  fadeStart = clock.getElapsedTime().asMilliseconds();
+  fadeLength = (sf::Int32)(fadeSeconds * 1000.f);
 
-  stream.play();
-  stream.setLoop(loop);
+  stream->music.setVolume(fadeLength > 0 ? 0.f : GetEffectiveStreamVolume());
+  stream->music.setLoop(loop);
 
   if(loop) {
-    stream.setLoopPoints(span);
+    stream->music.setLoopPoints(span);
   }
 
+  stream->music.play();
+
   return 0;
 }
 
+void AudioResourceManager::UpdateFade() {
+  if (!stream || fadeLength <= 0) return;
+
+  sf::Int32 now = clock.getElapsedTime().asMilliseconds();
+  float t = std::min(1.f, (float)(now - fadeStart) / (float)fadeLength);
+  float volume = GetEffectiveStreamVolume();
+
+  stream->music.setVolume(volume * t);
+
+  if (fadingOut) {
+    fadingOut->music.setVolume(volume * (1.f - t));
+  }
+
+  if (t >= 1.f) {
+    if (fadingOut) {
+      fadingOut->music.stop();
+      fadingOut.reset();
+    }
+
+    fadeLength = 0;
+  }
+}
+
 void AudioResourceManager::StopStream() {
-  stream.stop();
+  if (stream) {
+    stream->music.stop();
+    stream.reset();
+  }
+
+  if (fadingOut) {
+    fadingOut->music.stop();
+    fadingOut.reset();
+  }
+
+  fadeLength = 0;
 }
 
 void AudioResourceManager::SetStreamVolume(float volume) {
-  stream.setVolume(volume);
+  if (stream) {
+    stream->music.setVolume(volume);
+  }
+
+  if (fadingOut) {
+    fadingOut->music.setVolume(volume);
+  }
+
   streamVolume = volume;
 }
 
+const float AudioResourceManager::GetEffectiveStreamVolume() const {
+  return isEnabled ? streamVolume : 0.f;
+}
+
 void AudioResourceManager::SetChannelVolume(float volume) {
   for (int i = 0; i < NUM_OF_CHANNELS; i++) {
     channels[i].buffer.setVolume(volume);
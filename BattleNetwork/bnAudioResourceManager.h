@@ -3,12 +3,20 @@
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/Music.hpp>
+#include <SFML/System/Clock.hpp>
 #include "bnAudioType.h"
+#include "bnTaskPool.h"
 #include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
 
 // For more retro experience, decrease available channels.
 #define NUM_OF_CHANNELS 10
 
+// Tracks opened ahead of time. The oldest is closed when more are prefetched.
+#define MAX_PREFETCHED_STREAMS 4
+
 // Prevent duplicate sounds from stacking on same frame
 // Allows duplicate audio samples to play in X ms apart from eachother
 #define AUDIO_DUPLICATES_ALLOWED_IN_X_MILLISECONDS 58 // 58ms = ~3.5 frames
@@ -54,6 +62,13 @@ public:
    * @param status thread-safe counter will reach total count of all samples to load when finished.
    */
   void LoadAllSources(std::atomic<int> &status);
+
+  /**
+   * @brief Decodes all samples on the pool's workers. Increases status value as each sample finishes.
+   * @param pool workers to decode on. Must finish before status goes out of scope.
+   * @param status thread-safe counter will reach total count of all samples to load when finished.
+   */
+  void QueueAllSources(TaskPool& pool, std::atomic<int> &status);
   
   /**
    * @brief Loads an audio source at path and map it to enum type
@@ -63,13 +78,44 @@ public:
   void LoadSource(AudioType type, const std::string& path);
   
   /**
-   * @brief Play a sound with an audio priority
+   * @brief Queue a sound with an audio priority to play on the next Flush()
    * @param type audio to play
    * @param priority describes if and how to interrupt other playing samples
-   * @return -1 if could not play, otherwise 0
+   * @return -1 if audio is disabled or type is invalid, otherwise 0
+   * 
+   * Requests for the same sound in one frame are merged and keep the highest priority
    */
   int Play(AudioType type, AudioPriority priority = AudioPriority::LOW);
+
+  /**
+   * @brief Plays this frame's queued sounds. Call once per frame from the main loop.
+   * 
+   * Requests are handled highest priority first. Duplicates, free voices and which voice
+   * to steal are decided from a cached voice table instead of querying every sf::Sound.
+   */
+  void Flush();
+
+  /**
+   * @brief Opens a music file on the audio loader thread so a later Stream() of it starts without touching the disk
+   * @param path music file scenes expect to stream soon
+   * 
+   * Scenes call this when they know their upcoming tracks, e.g. in their constructor
+   */
+  void PrefetchStream(const std::string& path);
+
+  /**
+   * @brief Replaces the current music with path
+   * @return -1 if audio is disabled or the file could not be opened, otherwise 0
+   * 
+   * Swaps in a prefetched track if there is one, otherwise opens the file on this thread
+   */
   int Stream(std::string path, bool loop = false, sf::Music::TimeSpan span = sf::Music::TimeSpan());
+
+  /**
+   * @brief Like Stream() but fades the current music out while the new one fades in
+   * @param seconds length of the crossfade. Advanced by Flush().
+   */
+  int CrossfadeStream(std::string path, float seconds, bool loop = false, sf::Music::TimeSpan span = sf::Music::TimeSpan());
   void StopStream();
   void SetStreamVolume(float volume);
   void SetChannelVolume(float volume);
@@ -81,11 +127,60 @@ private:
   struct Channel {
     sf::Sound buffer;
     AudioPriority priority;
+    AudioType type; /*!< AUDIO_TYPE_SIZE if the channel never played */
+    sf::Int32 startedAt; /*!< ms on the manager's clock */
+    sf::Int32 endsAt; /*!< ms on the manager's clock */
   };
 
+  struct Request {
+    AudioType type;
+    AudioPriority priority;
+  };
+
+  /*! \brief A music file opened now or ahead of time */
+  struct MusicTrack {
+    std::string path;
+    sf::Music music;
+    std::atomic<bool> loading{ true }; /*!< True until the loader thread has opened the file */
+    bool opened = false; /*!< Valid once loading is false */
+  };
+
+  /**
+   * @brief Hands over the prefetched track for path, waiting if it is still opening, or opens it now
+   */
+  std::shared_ptr<MusicTrack> TakeStream(const std::string& path);
+
+  /**
+   * @brief Starts playing a track, fading over fadeSeconds if non zero
+   */
+  int StartStream(const std::string& path, bool loop, sf::Music::TimeSpan span, float fadeSeconds);
+
+  /**
+   * @brief Advances an active crossfade
+   */
+  void UpdateFade();
+
+  /**
+   * @brief Music volume with the enabled state applied
+   */
+  const float GetEffectiveStreamVolume() const;
+
+  /**
+   * @brief Picks a channel for the request following the priority rules
+   * @return -1 if the request should not play
+   */
+  int FindChannel(const Request& request, sf::Int32 now) const;
+
   Channel* channels;
+  std::vector<Request> queue; /*!< This frame's requests */
+  int queued[AUDIO_TYPE_SIZE]; /*!< Index of each type in queue or -1 */
+  sf::Clock clock; /*!< Time base for the voice table */
   sf::SoundBuffer* sources;
-  sf::Music stream;
+  std::shared_ptr<MusicTrack> stream; /*!< Current music */
+  std::shared_ptr<MusicTrack> fadingOut; /*!< Previous music during a crossfade */
+  std::vector<std::shared_ptr<MusicTrack>> prefetched; /*!< Opened or opening, oldest first */
+  sf::Int32 fadeStart, fadeLength; /*!< ms on the manager's clock */
+  TaskPool streamLoader; /*!< Single worker that opens prefetched music */
   float channelVolume;
   float streamVolume;
   bool isEnabled;
@@ -97,7 +97,6 @@ public:
    * @param height of screen
    */
   Background(sf::Texture& ref, int width, int height) : offset(0,0), textureRect(0, 0, width, height), width(width), height(height), texture(ref) {
-      texture = ref;
       texture.setRepeated(true);
 
       vertices.setPrimitiveType(sf::Triangles);
@@ -109,6 +108,16 @@ public:
       textureWrap = SHADERS.GetShader(ShaderType::TEXEL_TEXTURE_WRAP);
   }
 
+  /**
+   * @brief Constructs background from a cached texture and keeps the texture alive
+   * @param ref texture handle from TextureResourceManager
+   * @param width of screen
+   * @param height of screen
+   */
+  Background(const std::shared_ptr<sf::Texture>& ref, int width, int height) : Background(*ref, width, height) {
+    handle = ref;
+  }
+
   ~Background() { ;  }
   
   /**
@@ -159,6 +168,7 @@ public:
 protected:
   sf::VertexArray vertices; /*!< Geometry */
   sf::Texture& texture; /*!< Texture aka spritesheet if animated */
+  std::shared_ptr<sf::Texture> handle; /*!< Keeps cached textures alive. Empty for preloaded textures */
   sf::IntRect textureRect; /*!< Frame of the animation if applicable */
   sf::Vector2f offset; /*!< Offset of the frame in pixels */
   int width, height; /*!< Dimensions of screen in pixels */
@@ -114,7 +114,7 @@ BattleResults::BattleResults(sf::Time battleLength, int moveCount, int hitCount,
   star = sf::Sprite(LOAD_TEXTURE(BATTLE_RESULTS_STAR));
   star.setScale(2.f, 2.f);
   
-  sf::Font *font = TEXTURES.LoadFontFromFile("resources/fonts/mmbnthick_regular.ttf");
+  font = TEXTURES.LoadFontFromFile("resources/fonts/mmbnthick_regular.ttf");
 
   if (item) {
     sf::IntRect rect = TEXTURES.GetCardRectFromID(item->GetID());
@@ -3,6 +3,7 @@
 #include <SFML/System.hpp>
 #include <SFML/Graphics.hpp>
 #include <array> 
+#include <memory>
 
 class Mob;
 class BattleItem;
@@ -22,6 +23,7 @@ private:
   sf::Text rank; /*!< Battle scored rank */
   sf::Text reward; /*!< Name of reward */
   sf::Text chipCode; /*!< Code for chips */
+  std::shared_ptr<sf::Font> font; /*!< Label font */
   sf::Sprite rewardCard; /*!< Reward card graphics */
   sf::Sprite pressA; /*!< Press A sprite */
   sf::Sprite star; /*!< Counter stars */
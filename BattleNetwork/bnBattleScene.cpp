@@ -11,6 +11,7 @@
 #include "bnJudgeTreeBackground.h"
 #include "bnPlayerHealthUI.h"
 #include "bnPaletteSwap.h"
+#include "bnEntityPool.h"
 
 // Android only headers
 #include "Android/bnTouchArea.h"
@@ -58,6 +59,10 @@ BattleScene::BattleScene(swoosh::ActivityController& controller, Player* player,
     Logger::Log(std::string("Warning: Mob was empty when battle started. Mob Type: ") + typeid(mob).name());
   }
 
+  // Open the music this battle will stream while the segue plays
+  AUDIO.PrefetchStream(GetBattleMusicPath());
+  AUDIO.PrefetchStream("resources/loops/enemy_deleted.ogg");
+
   /*
   Set Scene*/
   field = mob->GetField();
@@ -75,7 +80,8 @@ BattleScene::BattleScene(swoosh::ActivityController& controller, Player* player,
   background = mob->GetBackground();
 
   if (!background) {
-    int randBG = rand() % 9;
+    // Cosmetic. Keep it off the battle's generator so seeded battles play the same.
+    int randBG = Random().Next(9);
 
     if (randBG == 0) {
       background = new LanBackground();
@@ -243,16 +249,21 @@ BattleScene::BattleScene(swoosh::ActivityController& controller, Player* player,
   distortionMap.setRepeated(true);
   distortionMap.setSmooth(true);
 
-  textureSize = getController().getVirtualWindowSize();
+  heatTime = 0.f;
+
+  // Both passes read the mask of lava and ice tiles drawn each frame
+  heatPass = &postProcess.AddPass("heat", &heatShader)
+    .Read("distortionMapTexture", distortionMap)
+    .Read("maskTexture", "mask")
+    .SetUniform("distortionFactor", 0.01f)
+    .SetUniform("riseFactor", 0.04f);
 
-  heatShader.setUniform("texture", sf::Shader::CurrentTexture);
-  heatShader.setUniform("distortionMapTexture", distortionMap);
-  heatShader.setUniform("textureSizeIn", sf::Glsl::Vec2((float)textureSize.x, (float)textureSize.y));
+  icePass = &postProcess.AddPass("ice", &iceShader)
+    .Read("sceneTexture", "scene")
+    .Read("maskTexture", "mask")
+    .SetUniform("shine", 0.2f);
 
-  iceShader.setUniform("texture", sf::Shader::CurrentTexture);
-  iceShader.setUniform("sceneTexture", sf::Shader::CurrentTexture);
-  iceShader.setUniform("textureSizeIn", sf::Glsl::Vec2((float)textureSize.x, (float)textureSize.y));
-  iceShader.setUniform("shine", 0.2f);
+  effectMask.setPrimitiveType(sf::Triangles);
 
   shine = sf::Sprite(LOAD_TEXTURE(MOB_BOSS_SHINE));
   shine.setScale(2.f, 2.f);
@@ -267,6 +278,12 @@ BattleScene::~BattleScene()
 {
   components.clear();
   scenenodes.clear();
+
+  // The field owns every entity still standing, including the player
+  delete field;
+
+  // Hand the recycled spell and artifact memory back to the heap in one go
+  EntityPool::Release();
 }
 
 // What to do if we inject a chip publisher, subscribe it to the main listener
@@ -308,30 +325,14 @@ void BattleScene::Eject(Component * other)
 
 void BattleScene::ProcessNewestComponents()
 {
-  // effectively returns all of them
-  auto entities = field->FindEntities([](Entity* e) { return true; });
-
-  for (auto e : entities) {
-    if (e->components.size() > 0) {
-      // update the ledger
-      // Injects usually removes the owner so this step proceeds the lastComponentID update
-      auto latestID = e->components[0]->GetID();
-
-      if (e->lastComponentID < latestID) {
-        //std::cout << "latestID: " << latestID << " lastComponentID: " << e->lastComponentID << "\n";
-
-        for (auto c : e->components) {
-          if (c->GetID() <= e->lastComponentID) break; // Older components are last in order, we're done
-
-          // Otherwise inject into scene
-          c->Inject(*this);
-          // Logger::Log("component ID " + std::to_string(c->GetID()) + " was injected");
-        }
+  // The field hands over only what was registered since last frame
+  field->GetComponentRegistry().TakeAdded(newComponents);
 
-        e->lastComponentID = latestID;
-      }
-    }
+  for (auto c : newComponents) {
+    c->Inject(*this);
   }
+
+  newComponents.clear();
 }
 
 const bool BattleScene::IsBattleActive()
@@ -412,7 +413,7 @@ void BattleScene::OnDeleteEvent(Character & pending)
 
   // Find any AI using this character as a target and free that pointer  
   field->FindEntities([pendingPtr = &pending](Entity* in) {
-    auto agent = dynamic_cast<Agent*>(in);
+    auto agent = in->As<Agent>();
 
     if (agent && agent->GetTarget() == pendingPtr) {
       agent->FreeTarget();
@@ -427,6 +428,7 @@ void BattleScene::OnDeleteEvent(Character & pending)
 
 void BattleScene::onUpdate(double elapsed) {
   this->elapsed = elapsed;
+  this->heatTime += (float)elapsed;
 
   shineAnimation.Update((float)elapsed, shine);
 
@@ -573,7 +575,6 @@ void BattleScene::onUpdate(double elapsed) {
       // Show Enemy Deleted
       isPostBattle = true;
       battleEndTimer.reset();
-      AUDIO.StopStream();
       AUDIO.Stream("resources/loops/enemy_deleted.ogg");
       player->ChangeState<PlayerIdleState>();
     }
@@ -612,6 +613,10 @@ void BattleScene::onUpdate(double elapsed) {
 
     field->Update((float)elapsed);
   } 
+  else {
+    // The last tick's motion would otherwise be replayed every frame while frozen
+    field->HoldTickPositions();
+  }
 
   int newMobSize = mob->GetRemainingMobCount();
 
@@ -650,7 +655,7 @@ void BattleScene::onUpdate(double elapsed) {
       if (battleTimer.isPaused()) {
         battleTimer.start();
         comboDeleteCounter = 0; // reset the combo
-        Logger::Log("comboDeleteCounter reset");
+        BN_LOG(Debug, Battle, "comboDeleteCounter reset");
       }
     }
 
@@ -706,6 +711,16 @@ void BattleScene::onDraw(sf::RenderTexture& surface) {
   auto allTiles = field->FindTiles([](Battle::Tile* tile) { return true; });
   auto tilesIter = allTiles.begin();
 
+  // Tiles and entities are merged into as few draw calls as the texture and shader changes allow
+  ENGINE.BeginBatch();
+
+  bool backdropActive = summons.IsSummonActive() || showSummonBackdrop || isChangingForm;
+
+  if (backdropActive) {
+    // Every tile shares the same opacity this frame
+    pauseShader.setUniform("opacity", (float)backdropOpacity*float(std::max(0.0, (showSummonBackdropTimer / showSummonBackdropLength))));
+  }
+
   while (tilesIter != allTiles.end()) {
     tile = (*tilesIter);
 
@@ -717,23 +732,14 @@ void BattleScene::onDraw(sf::RenderTexture& surface) {
 
     tile->move(ENGINE.GetViewOffset());
 
-    if (summons.IsSummonActive() || showSummonBackdrop || isChangingForm) {
-      SpriteSceneNode* coloredTile = new SpriteSceneNode(*(sf::Sprite*)tile);
-      coloredTile->SetShader(&pauseShader);
-      pauseShader.setUniform("opacity", (float)backdropOpacity*float(std::max(0.0, (showSummonBackdropTimer / showSummonBackdropLength))));
-      ENGINE.Draw(coloredTile);
-      delete coloredTile;
+    if (backdropActive) {
+      ENGINE.DrawBatched(*tile, &pauseShader);
+    }
+    else if (tile->IsHighlighted()) {
+      ENGINE.DrawBatched(*tile, &yellowShader);
     }
     else {
-      if (tile->IsHighlighted()) {
-        SpriteSceneNode* coloredTile = new SpriteSceneNode(*(sf::Sprite*)tile);
-        coloredTile->SetShader(&yellowShader);
-        ENGINE.Draw(coloredTile);
-        delete coloredTile;
-      }
-      else {
-        ENGINE.Draw(tile);
-      }
+      ENGINE.DrawBatched(*tile);
     }
 
     tile->move(-ENGINE.GetViewOffset());
@@ -752,15 +758,18 @@ void BattleScene::onDraw(sf::RenderTexture& surface) {
       lastRow = (*tilesIter)->GetY();
 
       // Ensure all entities are sorted by layer
-      std::sort(entitiesOnRow.begin(), entitiesOnRow.end(), [](Entity* a, Entity*b) -> bool { return a->GetLayer() > b->GetLayer(); });
+      Engine::SortDrawOrder(entitiesOnRow);
 
       // draw this row
       for (auto entity : entitiesOnRow) {
-        entity->move(ENGINE.GetViewOffset());
+        // Draw between the last two ticks so motion stays smooth at any refresh rate
+        sf::Vector2f offset = ENGINE.GetViewOffset() + entity->GetInterpolatedOffset(ENGINE.GetInterpolationAlpha());
+
+        entity->move(offset);
 
         ENGINE.Draw(entity);
 
-        entity->move(-ENGINE.GetViewOffset());
+        entity->move(-offset);
       }
 
       // prepare for bext row
@@ -768,18 +777,6 @@ void BattleScene::onDraw(sf::RenderTexture& surface) {
     }
 
       tile = (*tilesIter);
-      static float totalTime = 0;
-      totalTime += (float)elapsed;
-
-      //heatShader.setUniform("time", totalTime*0.02f);
-      //heatShader.setUniform("distortionFactor", 0.01f);
-      //heatShader.setUniform("riseFactor", 0.1f);
-
-      //heatShader.setUniform("w", tile->GetWidth() - 8.f);
-      //heatShader.setUniform("h", tile->GetHeight()*1.5f);
-
-      //iceShader.setUniform("w", tile->GetWidth() - 8.f);
-      //iceShader.setUniform("h", tile->GetHeight()*0.8f);
 
       Entity* entity = nullptr;
 
@@ -804,65 +801,46 @@ void BattleScene::onDraw(sf::RenderTexture& surface) {
           entitiesIter++;
       }
 
-      /*if (tile->GetState() == TileState::LAVA) {
-        heatShader.setUniform("x", tile->getPosition().x - tile->getTexture()->getSize().x + 3.0f);
-
-        float repos = (float)(tile->getPosition().y - (tile->getTexture()->getSize().y*2.5f));
-        heatShader.setUniform("y", repos);
-
-        surface.display();
-        sf::Texture postprocessing = surface.getTexture(); // Make a copy
-
-        sf::Sprite distortionPost;
-        distortionPost.setTexture(postprocessing);
-
-        surface.clear();
-
-        LayeredDrawable* bake = new LayeredDrawable(distortionPost);
-        bake->SetShader(&heatShader);
-
-        ENGINE.Draw(bake);
-        delete bake;
-      }
-      else if (tile->GetState() == TileState::ICE) {
-        iceShader.setUniform("x", tile->getPosition().x - tile->getTexture()->getSize().x);
-
-        float repos = (float)(tile->getPosition().y - tile->getTexture()->getSize().y);
-        iceShader.setUniform("y", repos);
-
-        surface.display();
-        sf::Texture postprocessing = surface.getTexture(); // Make a copy
-
-        sf::Sprite reflectionPost;
-        reflectionPost.setTexture(postprocessing);
-
-        surface.clear();
-
-        LayeredDrawable* bake = new LayeredDrawable(reflectionPost);
-        bake->SetShader(&iceShader);
-
-        ENGINE.Draw(bake);
-        delete bake;
-      }*/
         tilesIter++;
   }
 
   // Last row needs to be drawn now that the loop is over
   // Ensure all entities are sorted by layer
-  std::sort(entitiesOnRow.begin(), entitiesOnRow.end(), [](Entity* a, Entity*b) -> bool { return a->GetLayer() > b->GetLayer(); });
+  Engine::SortDrawOrder(entitiesOnRow);
 
   // draw this row
   for (auto entity : entitiesOnRow) {
-    entity->move(ENGINE.GetViewOffset());
+    sf::Vector2f offset = ENGINE.GetViewOffset() + entity->GetInterpolatedOffset(ENGINE.GetInterpolationAlpha());
+
+    entity->move(offset);
 
     ENGINE.Draw(entity);
 
-    entity->move(-ENGINE.GetViewOffset());
+    entity->move(-offset);
   }
 
   // prepare for bext row
   entitiesOnRow.clear();
 
+  // Scene nodes and ui draw to the surface directly
+  ENGINE.EndBatch();
+
+  // Heat and ice distort what is on the field, not the ui drawn over it
+  if (MarkEffectTiles(allTiles)) {
+    sf::RenderTexture* mask = ENGINE.AcquireRenderTarget(surface.getSize());
+    mask->setView(surface.getView());
+    mask->draw(effectMask, sf::RenderStates(sf::BlendAdd));
+    mask->display();
+
+    heatPass->SetUniform("time", heatTime);
+
+    postProcess.SetInput("mask", &mask->getTexture());
+    ENGINE.PostProcess(postProcess);
+    postProcess.SetInput("mask", nullptr);
+
+    ENGINE.ReleaseRenderTarget(mask);
+  }
+
   // Draw scene nodes
   for (auto node : scenenodes) {
     surface.draw(*node);
@@ -1460,24 +1438,73 @@ void BattleScene::onDraw(sf::RenderTexture& surface) {
   customBarShader.setUniform("factor", (float)(customProgress / customDuration));
 }
 
+const std::string BattleScene::GetBattleMusicPath() const {
+  if (mob->HasCustomMusicPath()) {
+    return mob->GetCustomMusicPath();
+  }
+
+  return mob->IsBoss() ? "resources/loops/loop_boss_battle.ogg" : "resources/loops/loop_battle.ogg";
+}
+
+const bool BattleScene::MarkEffectTiles(const std::vector<Battle::Tile*>& tiles) {
+  effectMask.clear();
+
+  bool hasLava = false;
+  bool hasIce = false;
+
+  // Appends a rectangle shaded from top to bottom
+  auto mark = [this](float left, float top, float right, float bottom, sf::Color topColor, sf::Color bottomColor) {
+    sf::Vertex topLeft(sf::Vector2f(left, top), topColor);
+    sf::Vertex topRight(sf::Vector2f(right, top), topColor);
+    sf::Vertex bottomLeft(sf::Vector2f(left, bottom), bottomColor);
+    sf::Vertex bottomRight(sf::Vector2f(right, bottom), bottomColor);
+
+    effectMask.append(topLeft);
+    effectMask.append(bottomLeft);
+    effectMask.append(topRight);
+    effectMask.append(topRight);
+    effectMask.append(bottomLeft);
+    effectMask.append(bottomRight);
+  };
+
+  for (auto tile : tiles) {
+    if (tile->IsEdgeTile()) continue;
+
+    sf::Vector2f pos = tile->getPosition() + ENGINE.GetViewOffset();
+    float left = pos.x - (tile->GetWidth() * 0.5f) + 4.f;
+    float right = pos.x + (tile->GetWidth() * 0.5f) - 4.f;
+    float top = pos.y - (tile->GetHeight() * 0.5f);
+
+    if (tile->GetState() == TileState::LAVA) {
+      // Hot air rises from the panel and cools off a panel and a half above it
+      mark(left, pos.y - tile->GetHeight()*1.5f, right, pos.y, sf::Color::Black, sf::Color::Red);
+      hasLava = true;
+    }
+    else if (tile->GetState() == TileState::ICE) {
+      mark(left, top, right, top + tile->GetHeight()*0.8f, sf::Color::Green, sf::Color::Green);
+      hasIce = true;
+    }
+  }
+
+  heatPass->SetEnabled(hasLava);
+  icePass->SetEnabled(hasIce);
+
+  return hasLava || hasIce;
+}
+
 void BattleScene::onStart() {
   isSceneInFocus = true;
 
   // Stream battle music
-  if (mob->HasCustomMusicPath()) {
-    AUDIO.Stream(mob->GetCustomMusicPath(), true);
+  if (mob->HasCustomMusicPath() || mob->IsBoss()) {
+    AUDIO.Stream(GetBattleMusicPath(), true);
   }
   else {
-    if (!mob->IsBoss()) {
-      sf::Music::TimeSpan span;
-      span.offset = sf::microseconds(84);
-      span.length = sf::seconds(120.0f * 1.20668f);
+    sf::Music::TimeSpan span;
+    span.offset = sf::microseconds(84);
+    span.length = sf::seconds(120.0f * 1.20668f);
 
-      AUDIO.Stream("resources/loops/loop_battle.ogg", true, span);
-    }
-    else {
-      AUDIO.Stream("resources/loops/loop_boss_battle.ogg", true);
-    }
+    AUDIO.Stream(GetBattleMusicPath(), true, span);
   }
 
 #ifdef __ANDROID__
@@ -17,6 +17,7 @@
 #include "bnShaderResourceManager.h"
 #include "bnPA.h"
 #include "bnEngine.h"
+#include "bnPostProcessGraph.h"
 #include "bnSceneNode.h"
 #include "bnBattleResults.h"
 #include "bnBattleScene.h"
@@ -146,6 +147,7 @@ private:
 
   // Other components
   std::vector<Component*> components; /*!< Components injected into the scene */
+  std::vector<Component*> newComponents; /*!< Scratch list reused by ProcessNewestComponents() */
 
   /*
   Background for scene*/
@@ -154,11 +156,11 @@ private:
   int randBG; /*!< If background provided by Mob data is nullptr, randomly select one */
 
   // PAUSE
-  sf::Font* font; /*!< PAUSE font */
+  std::shared_ptr<sf::Font> font; /*!< PAUSE font */
   sf::Text* pauseLabel; /*!< "PAUSE" test */
 
   // CHIP CUST GRAPHICS
-  sf::Texture* customBarTexture; /*!< Cust gauge image */
+  std::shared_ptr<sf::Texture> customBarTexture; /*!< Cust gauge image */
   SpriteSceneNode customBarSprite; /*!< Cust gauge sprite */
   sf::Vector2f customBarPos; /*!< Cust gauge position */
 
@@ -167,7 +169,7 @@ private:
   double chipSelectInputCooldown; /*!< Time remaining with delayed input */
 
   // MOB
-  sf::Font *mobFont; /*!< Name of mob font */
+  std::shared_ptr<sf::Font> mobFont; /*!< Name of mob font */
   Mob* mob; /*!< Mob and mob data player are fighting against */
 
   // States. TODO: Abstract this further into battle state classes 
@@ -225,7 +227,13 @@ private:
 
   // Heat distortion effect
   sf::Texture& distortionMap; /*!< Distortion effect pixel sample source */
-  sf::Vector2u textureSize; /*!< Size of distorton effect */
+  float heatTime; /*!< Scrolls the distortion map */
+
+  // Tile effects
+  PostProcessGraph postProcess; /*!< Heat and ice passes, run once per frame over the whole screen */
+  PostProcessPass* heatPass;
+  PostProcessPass* icePass;
+  sf::VertexArray effectMask; /*!< Lava columns in red, ice panels in green */
 
   //graphics that appear onscreen
   std::vector<SceneNode*> scenenodes; /*!< Scene node system */
@@ -250,6 +258,18 @@ private:
 
   virtual void OnDeleteEvent(Character& pending);
 
+  /**
+   * @brief The mob's custom music or the default battle loop for its kind
+   */
+  const std::string GetBattleMusicPath() const;
+
+  /**
+   * @brief Marks the lava and ice tiles in effectMask and enables the passes they need
+   * @param tiles
+   * @return true if any tile was marked
+   */
+  const bool MarkEffectTiles(const std::vector<Battle::Tile*>& tiles);
+
 #ifdef __ANDROID__
   void SetupTouchControls();
   void ShutdownTouchControls();
@@ -338,7 +358,7 @@ public:
   void Eject(Component* other);
 
   /**
-   * @brief Scans the entity list for updated components and tries to Inject them if the components require.
+   * @brief Injects the components the field registered since the last call
    */
   void ProcessNewestComponents();
 
@@ -0,0 +1,143 @@
+#include "bnBattleSimulation.h"
+#include "bnPlayer.h"
+#include "bnMob.h"
+#include "bnField.h"
+#include "bnAgent.h"
+#include "bnChipFolder.h"
+#include "bnChipAction.h"
+#include "bnLogger.h"
+#include "bnEntityPool.h"
+
+BattleSimulation::BattleSimulation(Player* player, Mob* mob, ChipFolder& folder, double maxSeconds) :
+  player(player),
+  mob(mob),
+  field(mob->GetField()),
+  folder(folder.Clone()),
+  chipListener(player),
+  elapsed(0),
+  maxSeconds(maxSeconds),
+  chipCooldown(CHIP_INTERVAL),
+  ticks(0),
+  isMobStarted(false),
+  isPlayerDeleted(false),
+  outcome(Outcome::ongoing) {
+
+  if (mob->GetMobCount() == 0) {
+    Logger::Log("Warning: Mob was empty when simulation started");
+  }
+
+  // Same as the mob select screen: the battle's generator decides the draw order
+  this->folder->Shuffle(field->GetRandom());
+
+  this->CharacterDeleteListener::Subscribe(*field);
+  chipListener.Subscribe(*this);
+
+  player->ChangeState<PlayerIdleState>();
+  field->AddEntity(*player, 2, 2);
+}
+
+BattleSimulation::~BattleSimulation() {
+  delete folder;
+  delete mob;
+
+  // The field owns every entity still standing, including the player
+  delete field;
+
+  // Nothing on this thread needs the recycled spell and artifact memory until the next battle
+  EntityPool::Release();
+}
+
+void BattleSimulation::Step(double elapsed) {
+  if (outcome != Outcome::ongoing) return;
+
+  this->elapsed += elapsed;
+  ticks++;
+
+  if (mob->IsCleared() && !isPlayerDeleted) {
+    outcome = Outcome::won;
+    return;
+  }
+  else if (isPlayerDeleted) {
+    outcome = Outcome::lost;
+    return;
+  }
+  else if (this->elapsed >= maxSeconds) {
+    outcome = Outcome::timeout;
+    return;
+  }
+
+  if (mob->NextMobReady()) {
+    Mob::MobData* data = mob->GetNextMob();
+
+    // Some entities have AI and need targets
+    if (Agent* agent = data->mob->As<Agent>()) {
+      agent->SetTarget(player);
+    }
+
+    field->AddEntity(*data->mob, data->tileX, data->tileY);
+  }
+  else if (!isMobStarted && mob->IsSpawningDone()) {
+    // Same as closing the first chip select: enemies leave their intro
+    isMobStarted = true;
+    mob->DefaultState();
+    field->SetBattleActive(true);
+  }
+
+  if (isMobStarted) {
+    chipCooldown -= elapsed;
+
+    if (chipCooldown <= 0) {
+      chipCooldown = CHIP_INTERVAL;
+      UseNextChip();
+    }
+  }
+
+  field->Update((float)elapsed);
+
+  // There is no scene to inject the new components into
+  field->GetComponentRegistry().ClearAdded();
+}
+
+const BattleSimulation::Outcome BattleSimulation::GetOutcome() const {
+  return outcome;
+}
+
+const unsigned BattleSimulation::GetTicks() const {
+  return ticks;
+}
+
+const double BattleSimulation::GetElapsed() const {
+  return elapsed;
+}
+
+void BattleSimulation::UseNextChip() {
+  if (!player || player->GetComponentsDerivedFrom<ChipAction>().size()) {
+    return;
+  }
+
+  Chip* next = folder->Next();
+
+  if (next) {
+    this->Broadcast(*next, *player);
+  }
+}
+
+void BattleSimulation::OnDeleteEvent(Character& pending) {
+  if (!isPlayerDeleted && player == &pending) {
+    isPlayerDeleted = true;
+    player = nullptr;
+  }
+
+  // Find any AI using this character as a target and free that pointer
+  field->FindEntities([pendingPtr = &pending](Entity* in) {
+    auto agent = in->As<Agent>();
+
+    if (agent && agent->GetTarget() == pendingPtr) {
+      agent->FreeTarget();
+    }
+
+    return false;
+  });
+
+  mob->Forget(pending);
+}
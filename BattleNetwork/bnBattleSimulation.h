@@ -0,0 +1,82 @@
+/*! \file bnBattleSimulation.h */
+
+/*! \brief Runs the battle rules of BattleScene without any presentation
+ *
+ * Spawns the mob, updates the field, feeds the player's folder through the chip listener
+ * and watches for deletions the same way BattleScene does. There is no chip select, no
+ * UI, no camera and no drawing. The player stands still and uses the next chip in
+ * the folder every CHIP_INTERVAL seconds.
+ *
+ * Used by the BattleNetworkSim target to measure how fast the battle logic runs on its own.
+ */
+
+#pragma once
+#include "bnCharacterDeleteListener.h"
+#include "bnChipUsePublisher.h"
+#include "bnPlayerChipUseListener.h"
+
+class Player;
+class Mob;
+class Field;
+class ChipFolder;
+
+class BattleSimulation : public CharacterDeleteListener, public ChipUsePublisher {
+public:
+  /*! \brief How the battle ended */
+  enum class Outcome : int {
+    ongoing = 0,
+    won,
+    lost,
+    timeout
+  };
+
+  static constexpr double CHIP_INTERVAL = 1.0; /*!< Seconds between chip uses */
+
+  /**
+   * @brief Places the player on the mob's field
+   * @param player navi to battle with
+   * @param mob mob to fight. Owns the field.
+   * @param folder chips the player will use. The simulation shuffles a clone with the field's generator.
+   * @param maxSeconds simulated seconds before the battle is called a timeout
+   */
+  BattleSimulation(Player* player, Mob* mob, ChipFolder& folder, double maxSeconds);
+
+  /**
+   * @brief Deletes the mob, its field and every entity on it
+   */
+  ~BattleSimulation();
+
+  /**
+   * @brief Advances the battle by one tick
+   * @param elapsed seconds
+   */
+  void Step(double elapsed);
+
+  const Outcome GetOutcome() const;
+  const unsigned GetTicks() const;
+  const double GetElapsed() const;
+
+  /**
+   * @brief Uses the next chip in the folder if the player is not busy with one
+   */
+  void UseNextChip();
+
+  /**
+   * @brief Frees AI targets and forgets the character like BattleScene
+   */
+  void OnDeleteEvent(Character& pending);
+
+private:
+  Player* player;
+  Mob* mob;
+  Field* field;
+  ChipFolder* folder; /*!< Clone of the folder passed in */
+  PlayerChipUseListener chipListener;
+  double elapsed;
+  double maxSeconds;
+  double chipCooldown;
+  unsigned ticks;
+  bool isMobStarted; /*!< Enemies left their intro state */
+  bool isPlayerDeleted;
+  Outcome outcome;
+};
@@ -10,7 +10,8 @@
 BombChipAction::BombChipAction(Character * owner, int damage) : ChipAction(owner, "PLAYER_THROW", &attachment, "Hand") {
   this->damage = damage;
 
-  overlay.setTexture(*TextureResourceManager::GetInstance().LoadTextureFromFile(PATH));
+  overlayTexture = TextureResourceManager::GetInstance().LoadTextureFromFile(PATH);
+  overlay.setTexture(*overlayTexture);
   this->attachment = new SpriteSceneNode(overlay);
   this->attachment->SetLayer(-1);
 }
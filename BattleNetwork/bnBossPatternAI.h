@@ -1,5 +1,6 @@
 #pragma once
 #include "bnAIState.h"
+#include "bnAIStateSlot.h"
 #include "bnEntity.h"
 #include "bnAgent.h"
 #include "bnNoState.h"
@@ -9,6 +10,7 @@ class BossPatternAI : public Agent {
 private:
   std::vector<AIState<CharacterT>*> stateMachine; /*!< State machine responsible for state management */
   AIState<CharacterT>* interruptState;
+  AIStateSlot<CharacterT> interruptSlot; /*!< Interrupts come and go during the fight. Built in place. */
   int stateIndex;
   CharacterT* ref; /*!< AI of this instance */
   int lock; /*!< Whether or not a state is locked */
@@ -46,6 +48,7 @@ public:
   BossPatternAI(CharacterT* _ref) : Agent() {
     interruptState = nullptr;
     ref = _ref;
+    ref->template Tag<Agent>(this);
     lock = BossPatternAI<CharacterT>::StateLock::Unlocked;
     isUpdating = gotoNext = beginInterrupt = endInterrupt = false;
     stateIndex = 0;
@@ -120,10 +123,9 @@ public:
 
     if (interruptState) { 
       interruptState->OnLeave(*ref);
-      delete interruptState;  
     }
 
-    interruptState = new U();
+    interruptState = interruptSlot.template Emplace<U>();
     beginInterrupt = true;
   }
 
@@ -140,10 +142,9 @@ public:
 
     if (interruptState) { 
       interruptState->OnLeave(*ref);
-      delete interruptState; 
     }
 
-    interruptState = new U(args...);
+    interruptState = interruptSlot.template Emplace<U>(args...);
     beginInterrupt = true;
   }
 
@@ -184,8 +185,8 @@ public:
 
         endInterrupt = false;
 
-        delete interruptState;
         interruptState = nullptr;
+        interruptSlot.Reset();
       }
     } else if (stateIndex < stateMachine.size()) {
       stateMachine[stateIndex]->Update(_elapsed, *ref);
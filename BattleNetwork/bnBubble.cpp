@@ -111,7 +111,7 @@ void Bubble::Attack(Character* _entity) {
   // TODO: Hack. Bubbles keep attacking team mates. Why?
   if(_entity->GetTeam() == Team::BLUE || popping) return;
 
-  Obstacle* other = dynamic_cast<Obstacle*>(_entity);
+  Obstacle* other = _entity->As<Obstacle>();
   Component* comp = dynamic_cast<Component*>(_entity);
 
   if (other) {
@@ -101,12 +101,12 @@ void Buster::Attack(Character* _entity) {
 
     if (!isCharged) {
       random = _entity->getLocalBounds().width / 2.0f;
-      random *= rand() % 2 == 0 ? -1.0f : 1.0f;
+      random *= GetField()->GetRandom().Next(2) == 0 ? -1.0f : 1.0f;
 
       hitHeight = (float)(std::floor(_entity->GetHeight()));
 
       if (hitHeight > 0) {
-        hitHeight = (float)(rand() % (int)hitHeight);
+        hitHeight = (float)(GetField()->GetRandom().Next((int)hitHeight));
       }
     }
   }
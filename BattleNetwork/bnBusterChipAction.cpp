@@ -8,6 +8,8 @@
 #define NODE_PATH "resources/spells/buster_shoot.png"
 #define NODE_ANIM "resources/spells/buster_shoot.animation"
 
+static const int ENDPOINT_POINT = FramePoints::Intern("endpoint");
+
 BusterChipAction::BusterChipAction(Character * owner, bool charged, int damage) : ChipAction(owner, "PLAYER_SHOOTING", &attachment2, "Buster"), 
 attachmentAnim(owner->GetFirstComponent<AnimationComponent>()->GetFilePath()) {
   this->damage = damage;
@@ -22,7 +24,7 @@ attachmentAnim(owner->GetFirstComponent<AnimationComponent>()->GetFilePath()) {
   attachmentAnim2.SetAnimation("BUSTER");
 
   this->attachment = new SpriteSceneNode();
-  this->attachment->setTexture(*TextureResourceManager::GetInstance().LoadTextureFromFile(NODE_PATH));
+  this->attachment->setTexture(TextureResourceManager::GetInstance().LoadTextureFromFile(NODE_PATH));
   this->attachment->SetLayer(-1);
 
   attachmentAnim = Animation(NODE_ANIM);
@@ -72,7 +74,7 @@ void BusterChipAction::OnUpdate(float _elapsed)
   ChipAction::OnUpdate(_elapsed);
 
   // update node position in the animation
-  auto baseOffset = attachmentAnim2.GetPoint("endpoint");
+  auto baseOffset = attachmentAnim2.GetPoint(ENDPOINT_POINT);
   auto origin = attachment2->getOrigin();
   baseOffset = baseOffset - origin;
 
@@ -48,8 +48,8 @@ void Camera::Update(float elapsed) {
       // Drop off to zero by end of shake
       double currStress = stress *(1 - (shakeProgress / shakeDur.asMilliseconds()));
 
-      int randomAngle = int(shakeProgress) * (rand() % 360);
-      randomAngle += (150 + (rand() % 60));
+      int randomAngle = int(shakeProgress) * random.Next(360);
+      randomAngle += (150 + random.Next(60));
 
       auto offset = sf::Vector2f(std::sin((float)randomAngle) * float(currStress), std::cos((float)randomAngle) * float(currStress));
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "bnRandom.h"
 
 /**
  * @class Camera
@@ -19,6 +20,7 @@ sf::View init; /*!< Initial view */
 float progress; /*!< Progress of movement */
 float shakeProgress; /*!< Progress of shake effect */
 bool isShaking; /*!< Flag for shaking camera */
+Random random; /*!< Shake angles. Cosmetic so it stays off the battle's generator */
 
 public:
   /**
@@ -18,7 +18,7 @@ Cannon::Cannon(Field* _field, Team _team, int _damage) : Spell(_field, _team){
   hit = false;
   progress = 0.0f;
 
-  random = rand() % 20 - 20;
+  random = GetField()->GetRandom().Next(20) - 20;
 
   if(_team == Team::RED) {
     SetDirection(Direction::RIGHT);
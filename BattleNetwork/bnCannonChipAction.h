@@ -2,12 +2,14 @@
 #include "bnChipAction.h"
 #include "bnAnimation.h"
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class SpriteSceneNode;
 class Character;
 class CannonChipAction : public ChipAction {
 private:
   sf::Sprite cannon;
+  std::shared_ptr<sf::Texture> cannonTexture;
   SpriteSceneNode* attachment;
   Animation attachmentAnim;
   int damage;
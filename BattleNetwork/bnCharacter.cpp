@@ -24,6 +24,7 @@ Character::Character(Rank _rank) :
   invokeDeletion(false),
   hit(false),
   CounterHitPublisher(), Entity() {
+  Tag<Character>(this);
 
   whiteout = SHADERS.GetShader(ShaderType::WHITE);
   stun = SHADERS.GetShader(ShaderType::YELLOW);
@@ -153,7 +154,7 @@ void Character::Update(float _elapsed) {
 bool Character::CanMoveTo(Battle::Tile * next)
 {
   auto occupied = [this](Entity* in) {
-    Character* c = dynamic_cast<Character*>(in);
+    Character* c = in->As<Character>();
 
     return c && c != this && !c->CanShareTileSpace();
   };
@@ -15,6 +15,7 @@ class ChipAction : public Component {
 protected:
   AnimationComponent* anim;
   std::string animation, nodeName;
+  int nodePointID; /*!< nodeName interned for the per-frame point lookup */
   std::string uuid, prevState;
   SpriteSceneNode** attachment;
   std::function<void()> prepareActionDelegate;
@@ -35,7 +36,10 @@ protected:
 
 public:
   /** Override get owner to always return a character type */
-  Character* GetOwner() { return GetOwnerAs<Character>(); }
+  Character* GetOwner() { 
+    Entity* entity = Component::GetOwner();
+    return entity ? entity->As<Character>() : nullptr; 
+  }
 
   ChipAction() = delete;
   ChipAction(const ChipAction& rhs) = delete;
@@ -43,6 +47,10 @@ public:
   ChipAction(Character * owner, std::string animation, SpriteSceneNode** attachment, std::string nodeName)
     : Component(owner), animation(animation), nodeName(nodeName), attachment(attachment)
   {
+    Tag(ComponentKind::chipAction);
+
+    nodePointID = FramePoints::Intern(nodeName);
+
     anim = owner->GetFirstComponent<AnimationComponent>();
 
     if (anim) {
@@ -99,7 +107,7 @@ public:
     if (!GetOwner() || !GetOwner()->GetTile() || !attachment) return;
 
     // update node position in the animation
-    auto baseOffset = anim->GetPoint(nodeName);
+    auto baseOffset = anim->GetPoint(nodePointID);
     auto origin = GetOwner()->getSprite().getOrigin();
     baseOffset = baseOffset - origin;
 
@@ -2,7 +2,6 @@
 #include <assert.h>
 #include <sstream>
 #include <algorithm>
-#include <random>
 
 ChipFolder::ChipFolder() {
   folderSize = initialSize = 0;
@@ -20,11 +19,9 @@ ChipFolder::~ChipFolder() {
   }
 }
 
-void ChipFolder::Shuffle()
+void ChipFolder::Shuffle(Random& random)
 {
-  std::random_device rng;
-  std::mt19937 urng(rng());
-  std::shuffle(folderList.begin(), folderList.end(), urng);
+  std::shuffle(folderList.begin(), folderList.end(), random);
 }
 
 ChipFolder* ChipFolder::Clone() {
@@ -1,6 +1,7 @@
 #pragma once
 #include "bnChip.h"
 #include "bnChipLibrary.h"
+#include "bnRandom.h"
 #include <vector>
 #include <algorithm>
 
@@ -44,8 +45,9 @@ public:
   
   /**
    * @brief Randomly shuffles the folder
+   * @param random generator to draw from. Pass the battle field's to replay the draw order from its seed.
    */
-  void Shuffle();
+  void Shuffle(Random& random);
   
   /**
    * @brief Returns a safe clone of all chips used in the folder
@@ -86,21 +88,22 @@ public:
 
   /**
    * @brief Make a completely random and valid chip folder based on library entries
+   * @param random generator to pick the chips with
    * @return new ChipFolder
    * 
    * Used for testing
    */
-  static ChipFolder MakeRandomFolder() {
+  static ChipFolder MakeRandomFolder(Random& random) {
     ChipFolder folder;
     folder.folderSize = folder.initialSize = ChipLibrary::GetInstance().GetSize();
 
     for (int i = 0; i < folder.folderSize; i++) {
-      int random = rand() % ChipLibrary::GetInstance().GetSize();
+      int index = random.Next((int)ChipLibrary::GetInstance().GetSize());
 
       // the folder contains random parts from the entire library
       ChipLibrary::Iter iter = ChipLibrary::GetInstance().Begin();
 
-      while (random-- > 0) {
+      while (index-- > 0) {
         iter++;
       }
 
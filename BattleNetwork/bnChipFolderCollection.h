@@ -4,6 +4,7 @@
 #include <vector>
 #include "bnChipFolder.h"
 #include "bnFileUtil.h"
+#include "bnLineTokenizer.h"
 #include <iostream>
 #include "bnLogger.h"
 
@@ -164,22 +165,16 @@ public:
   static ChipFolderCollection ReadFromFile(const std::string& path) {
     string data = FileUtil::Read(path);
 
-    int endline = 0;
-
     ChipFolderCollection collection;
     ChipFolder* currFolder = nullptr;
 
-    do {
-      endline = (int)data.find("\n");
-      string line = data.substr(0, endline);
+    LineTokenizer reader(data);
 
-      while (line.compare(0, 1, " ") == 0)
-        line.erase(line.begin()); // remove leading whitespaces
-      while (line.size() > 0 && line.compare(line.size() - 1, 1, " ") == 0)
-        line.erase(line.end() - 1); // remove trailing whitespaces
+    while (reader.Next()) {
+      std::string_view tag = reader.Tag();
 
-      if (line.find("Folder") != string::npos) {
-        string title = FileUtil::ValueOf("title", line);
+      if (tag == "Folder") {
+        string title = string(reader.Value("title"));
         std::cout << "Looking for folder " << title << std::endl;
 
         if (collection.HasFolder(title)) {
@@ -198,22 +193,20 @@ public:
 
         std::cout << "folder addr " << currFolder << std::endl;
       }
-
-      if (line.find("Chip") != string::npos) {
-        string name = FileUtil::ValueOf("name", line);
-        string code = FileUtil::ValueOf("code", line);
+      else if (tag == "Chip") {
+        string name = string(reader.Value("name"));
+        std::string_view code = reader.Value("code");
+        char codeChar = code.empty() ? '\0' : code[0];
 
         if(currFolder != nullptr) {
           // Query the library for this chip data and push into the folder.
-          currFolder->AddChip(CHIPLIB.GetChipEntry(name, code[0]));
+          currFolder->AddChip(CHIPLIB.GetChipEntry(name, codeChar));
         }
         else {
-          Logger::Log("Failed to add chip (" + name + ", " + code[0] + "), no folder in build scope!");
+          Logger::Log("Failed to add chip (" + name + ", " + codeChar + "), no folder in build scope!");
         }
       }
-
-      data = data.substr(endline + 1);
-    } while (endline > -1);
+    }
 
     return collection;
   }
@@ -1,5 +1,7 @@
 #include "bnChipLibrary.h"
+#include "bnAssetPack.h"
 #include "bnFileUtil.h"
+#include "bnProfiler.h"
 #include "bnTextureResourceManager.h"
 #include <assert.h>
 #include <sstream>
@@ -171,82 +173,32 @@ Chip ChipLibrary::GetChipEntry(const std::string name, const char code)
 }
 
 void ChipLibrary::LoadLibrary(const std::string& path) {
-  string data = FileUtil::Read(path);
-
-  int endline = 0;
+  PROFILE_ZONE("ChipLibrary::LoadLibrary");
 
-  do {
-    endline = (int)data.find("\n");
-    string line = data.substr(0, endline);
+  // Baked library already has one record per chip code
+  if (const AssetPack::Entry* entry = ASSETPACK.Find(path, AssetPack::EntryKind::chipLibrary)) {
+    const AssetPack::ChipRecord* chips = ASSETPACK.GetChips(*entry);
 
-    while (line.compare(0, 1, " ") == 0)
-      line.erase(line.begin()); // remove leading whitespaces
-    while (line.size() > 0 && line.compare(line.size() - 1, 1, " ") == 0)
-      line.erase(line.end() - 1); // remove trailing whitespaces
+    for (uint32_t i = 0; i < entry->count; i++) {
+      const AssetPack::ChipRecord& record = chips[i];
+      Element elemType = GetElementFromStr(ASSETPACK.GetString(record.type));
 
-    if (line[0] == '#') {
-      // Skip comments
-      data = data.substr(endline + 1);
-      continue;
+      library.insert(Chip(record.cardIndex, record.iconIndex, (char)record.code, record.damage, elemType,
+        ASSETPACK.GetString(record.name), ASSETPACK.GetString(record.desc), ASSETPACK.GetString(record.verbose), record.rarity));
     }
 
-    if (line.find("Chip") != string::npos) {
-      string cardID = FileUtil::ValueOf("cardIndex", line);
-      string iconID = FileUtil::ValueOf("iconIndex", line);
-      string name   = FileUtil::ValueOf("name", line);
-      string damage = FileUtil::ValueOf("damage", line);
-      string type = FileUtil::ValueOf("type", line);
-      string codes = FileUtil::ValueOf("codes", line);
-      string description = FileUtil::ValueOf("desc", line);
-      string rarity = FileUtil::ValueOf("rarity", line);
-
-      string longDescription;
-
-      try {
-        longDescription = FileUtil::ValueOf("verbose", line);
-      }
-      catch (...) {
-        longDescription = "This chip does not have extra information.";
-      }
-
-      // Trime white space
-      codes.erase(remove_if(codes.begin(), codes.end(), isspace), codes.end());
-
-      // Tokenize the string with delimeter as ','
-      std::istringstream codeStream(codes);
-      string code;
-
-      while (std::getline(codeStream, code, ',')) {
-        // For every code, push this into our database
-        if (code.empty())
-          continue;
-
-        Element elemType = GetElementFromStr(type);
-
-        Chip chip = Chip(atoi(cardID.c_str()), atoi(iconID.c_str()), code[0], atoi(damage.c_str()), elemType, name, description, longDescription, atoi(rarity.c_str()));
-        std::list<char> codes = this->GetChipCodes(chip);
-
-        /* Avoid code duplicates
-        if (codes.size() > 0) {
-          bool found = (std::find(codes.begin(), codes.end(), chip.GetCode()) != codes.end());
-
-          // Not a duplicate code, make sure information is correct
-          if (!found) {
-            // Simply update an existing chip entry by changing the code 
-            Chip first = GetChipEntry(chip.GetShortName(), *codes.begin());
-            chip = Chip(first.GetID(), first.GetIconID(), chip.GetCode(), first.GetDamage(), first.GetElement(), first.GetShortName(), first.GetDescription(), first.GetVerboseDescription(), first.GetRarity());
-            library.insert(chip);
-          }
-        }
-        else { // first entry
-           library.insert(chip);
-        }*/
-        library.insert(chip);
-      }
-    }
+    Logger::Log(std::string("library size: ") + std::to_string(this->GetSize()));
+    return;
+  }
+
+  string data = FileUtil::Read(path);
+
+  AssetParser::ParseChipLibrary(data, [this](const AssetParser::Chip& chip) {
+    Element elemType = GetElementFromStr(string(chip.type));
 
-    data = data.substr(endline + 1);
-  } while (endline > -1);
+    library.insert(Chip(chip.cardIndex, chip.iconIndex, chip.code, chip.damage, elemType,
+      string(chip.name), string(chip.desc), string(chip.verbose), chip.rarity));
+  });
 
   Logger::Log(std::string("library size: ") + std::to_string(this->GetSize()));
 }
@@ -129,8 +129,6 @@ ChipSelectionCust::~ChipSelectionCust() {
 
   chipCount = 0;
 
-  delete labelFont;
-  delete codeFont;
   delete folder;
 }
 
@@ -463,7 +461,8 @@ void ChipSelectionCust::SetPlayerFormOptions(const std::vector<PlayerFormMeta*>
   for (auto f : forms) {
     this->forms.push_back(f);
     sf::Sprite ui;
-    ui.setTexture(*TEXTURES.LoadTextureFromFile(f->GetUIPath()));
+    formUITextures.push_back(TEXTURES.LoadTextureFromFile(f->GetUIPath()));
+    ui.setTexture(*formUITextures.back());
     ui.setScale(2.f, 2.f);
     formUI.push_back(ui);
   }
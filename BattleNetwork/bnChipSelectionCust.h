@@ -53,8 +53,8 @@ private:
   mutable SpriteSceneNode formSelect;
   mutable SpriteSceneNode formCursor;
   sf::Shader& greyscale;
-  sf::Font* labelFont;
-  sf::Font* codeFont;
+  std::shared_ptr<sf::Font> labelFont;
+  std::shared_ptr<sf::Font> codeFont;
   mutable sf::Text smCodeLabel;
   mutable sf::Text label;
   mutable CustEmblem emblem;
@@ -62,6 +62,7 @@ private:
   int formCursorRow;
   int selectedForm, thisFrameSelectedForm;
   std::vector<sf::Sprite> formUI;
+  std::vector<std::shared_ptr<sf::Texture>> formUITextures;
   float formSelectQuitTimer;
   bool playFormSound;
 
@@ -13,15 +13,15 @@ class ChipSpawnPolicyChipset {
 public:
   std::vector<Chip> chips;
 
-  ChipSpawnPolicyChipset() {
+  ChipSpawnPolicyChipset(Random& random) {
     // Test chip
-    int random = rand() % 3;
+    int set = random.Next(3);
 
-    if (random == 0) {
+    if (set == 0) {
       chips.push_back(Chip(82, 154, '*', 0, Element::NONE, "AreaGrab", "Defends and reflects", "Press A to bring up a shield that protects you and reflects damage.", 2));
       chips.push_back(Chip(83, 0, 'K', 0, Element::NONE, "CrckPanel", "Cracks a panel", "", 2));
     }
-    else if(random == 2) {
+    else if(set == 2) {
       chips.push_back(Chip(75, 147, 'R', 30, Element::NONE, "Recov30", "Recover 30HP", "", 1));
       chips.push_back(Chip(82, 154, '*', 0, Element::NONE, "AreaGrab", "Defends and reflects", "Press A to bring up a shield that protects you and reflects damage.", 2));
     }
@@ -81,7 +81,7 @@ public:
     EnemyChipsUI* ui = new EnemyChipsUI(this->GetSpawned());
     this->GetSpawned()->RegisterComponent(ui);
 
-    ui->LoadChips(ChipSpawnPolicyChipset().chips);
+    ui->LoadChips(ChipSpawnPolicyChipset(mob.GetField()->GetRandom()).chips);
     //mob.DelegateComponent(ui);
 
     Component* healthui = new MobHealthUI(this->GetSpawned());
@@ -1,3 +1,18 @@
 #include "bnComponent.h"
+#include "bnComponentRegistry.h"
 
-long Component::numOfComponents = 0;
\ No newline at end of file
+long Component::numOfComponents = 0;
+
+Component::~Component() {
+  if (registry) {
+    registry->Remove(this);
+  }
+}
+
+void Component::FreeOwner() {
+  owner = nullptr;
+
+  if (registry) {
+    registry->Remove(this);
+  }
+}
@@ -1,7 +1,30 @@
 #pragma once
 
+#include <cstddef>
+
 class Entity;
+class ComponentRegistry;
 class BattleScene;
+class UIComponent;
+class ChipAction;
+
+/**
+ * @brief Bit flags for component base types queried every frame
+ * 
+ * Like EntityKind, this turns GetComponentsDerivedFrom() into a bitmask test
+ */
+enum class ComponentKind : unsigned {
+  none       = 0,
+  ui         = 1 << 0,
+  chipAction = 1 << 1
+};
+
+/**
+ * @brief Maps a type to its ComponentKind flag. Untagged types are ComponentKind::none and use RTTI.
+ */
+template<typename T> struct ComponentKindOf { static constexpr ComponentKind value = ComponentKind::none; };
+template<> struct ComponentKindOf<UIComponent> { static constexpr ComponentKind value = ComponentKind::ui; };
+template<> struct ComponentKindOf<ChipAction> { static constexpr ComponentKind value = ComponentKind::chipAction; };
 
 /**
  * @class Component
@@ -13,10 +36,15 @@ class BattleScene;
  * This allows for custom behavior on pre-existing effects, characters, and attacks
  */
 class Component {
+  friend class ComponentRegistry;
+
 private:
   Entity* owner; /*!< Who the component is attached to */
   static long numOfComponents; /*!< Resource counter to generate new IDs */
   long ID; /*!< ID for quick lookups, resource management, and scripting */
+  unsigned kind; /*!< ComponentKind flags set by each tagged base type */
+  ComponentRegistry* registry; /*!< The field registry updating this component, if any */
+  size_t registryBucket, registrySlot; /*!< Where the registry filed this component */
 
 public:
   Component() = delete;
@@ -25,8 +53,12 @@ public:
    * @brief Sets an owner and ID. Increments numOfComponents beforehand.
    * @param owner the entity to attach to
    */
-  Component(Entity* owner) { this->owner = owner; ID = ++numOfComponents;  };
-  virtual ~Component() { ; }
+  Component(Entity* owner) { this->owner = owner; ID = ++numOfComponents; kind = 0; registry = nullptr; registryBucket = registrySlot = 0; };
+
+  /**
+   * @brief Unregisters from the field's component registry
+   */
+  virtual ~Component();
 
   Component(Component&& rhs) = delete;
   Component(const Component& rhs) = delete;
@@ -48,9 +80,15 @@ public:
    * @brief Releases the pointer and sets it to null
    * 
    * Useful to identify if an entity has been removed from game but a component
-   * needs to act accordingly to this information
+   * needs to act accordingly to this information.
+   * The field no longer updates a component without an owner.
    */
-  void FreeOwner() { owner = nullptr; }
+  void FreeOwner();
+
+  /**
+   * @brief True if a field's ComponentRegistry updates this component instead of its owner
+   */
+  const bool IsScheduled() const { return registry != nullptr; }
 
   /**
    * @brief Get the Id of the component
@@ -58,6 +96,23 @@ public:
    */
   const long GetID() const { return ID; }
 
+  /**
+   * @brief Cast the component to a specialized type
+   * Tagged types (@see ComponentKind) are a bitmask test, otherwise falls back to dynamic_cast
+   * @return T* or null if the component is not a T
+   */
+  template<typename T>
+  T* As() {
+    constexpr ComponentKind flag = ComponentKindOf<T>::value;
+
+    if constexpr (flag == ComponentKind::none) {
+      return dynamic_cast<T*>(this);
+    }
+    else {
+      return (kind & static_cast<unsigned>(flag)) ? static_cast<T*>(this) : nullptr;
+    }
+  }
+
   /**
    * @brief Update must be implemented by child class
    * @param _elapsed in seconds
@@ -76,4 +131,11 @@ public:
    * @warning Components injected into the battle scene are updated and deleted. Free the owner if injecting.
    */
   virtual void Inject(BattleScene&) = 0;
+
+protected:
+  /**
+   * @brief Tagged base types call this in their constructor
+   * @param flag the ComponentKind of the base type
+   */
+  void Tag(ComponentKind flag) { kind |= static_cast<unsigned>(flag); }
 };
@@ -0,0 +1,138 @@
+#include "bnComponentRegistry.h"
+#include "bnComponent.h"
+#include "bnEntity.h"
+#include "bnProfiler.h"
+
+#include <algorithm>
+#include <typeinfo>
+
+ComponentRegistry::ComponentRegistry() : count(0), isUpdating(false), hasHoles(false) {
+}
+
+ComponentRegistry::~ComponentRegistry() {
+  for (auto& bucket : buckets) {
+    for (auto component : bucket.components) {
+      if (component) {
+        component->registry = nullptr;
+      }
+    }
+  }
+}
+
+void ComponentRegistry::Add(Component* component) {
+  if (!component || component->registry) return;
+
+  std::type_index type(typeid(*component));
+  auto iter = bucketOf.find(type);
+  size_t index;
+
+  if (iter == bucketOf.end()) {
+    index = buckets.size();
+    buckets.push_back(Bucket{ type, {} });
+    bucketOf.emplace(type, index);
+  }
+  else {
+    index = iter->second;
+  }
+
+  auto& list = buckets[index].components;
+
+  component->registry = this;
+  component->registryBucket = index;
+  component->registrySlot = list.size();
+
+  list.push_back(component);
+  added.push_back(component);
+  count++;
+}
+
+void ComponentRegistry::Remove(Component* component) {
+  if (!component || component->registry != this) return;
+
+  auto& list = buckets[component->registryBucket].components;
+  size_t slot = component->registrySlot;
+
+  if (isUpdating) {
+    // The sweep is walking this list. Leave a hole and compact afterwards.
+    list[slot] = nullptr;
+    hasHoles = true;
+  }
+  else {
+    Component* last = list.back();
+    list[slot] = last;
+    last->registrySlot = slot;
+    list.pop_back();
+  }
+
+  auto iter = std::find(added.begin(), added.end(), component);
+
+  if (iter != added.end()) {
+    added.erase(iter);
+  }
+
+  component->registry = nullptr;
+  count--;
+}
+
+void ComponentRegistry::Update(float _elapsed) {
+  PROFILE_ZONE("ComponentRegistry::Update");
+
+  isUpdating = true;
+
+  // Components and types added by the sweep itself wait for the next frame
+  const size_t bucketCount = buckets.size();
+
+  for (size_t b = 0; b < bucketCount; b++) {
+    const size_t size = buckets[b].components.size();
+
+    for (size_t i = 0; i < size; i++) {
+      Component* component = buckets[b].components[i];
+
+      if (!component) continue;
+
+      // Entities taken off the field are not updated, neither are their components
+      Entity* owner = component->GetOwner();
+
+      if (owner && !owner->GetTile()) continue;
+
+      component->OnUpdate(_elapsed);
+    }
+  }
+
+  isUpdating = false;
+
+  if (hasHoles) {
+    Compact();
+  }
+}
+
+void ComponentRegistry::TakeAdded(std::vector<Component*>& out) {
+  out.clear();
+  out.swap(added);
+}
+
+void ComponentRegistry::ClearAdded() {
+  added.clear();
+}
+
+const size_t ComponentRegistry::GetCount() const {
+  return count;
+}
+
+void ComponentRegistry::Compact() {
+  for (auto& bucket : buckets) {
+    auto& list = bucket.components;
+    size_t write = 0;
+
+    for (size_t read = 0; read < list.size(); read++) {
+      if (!list[read]) continue;
+
+      list[read]->registrySlot = write;
+      list[write++] = list[read];
+    }
+
+    list.resize(write);
+  }
+
+  hasHoles = false;
+}
@@ -0,0 +1,89 @@
+/*! \file bnComponentRegistry.h */
+
+#pragma once
+
+#include <cstddef>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+class Component;
+
+/**
+ * @class ComponentRegistry
+ * @brief Schedules the components of every entity on a field
+ *
+ * Components are filed in one bucket per concrete type when their owner joins
+ * the field, or when they are attached to an owner already on it. Update() then
+ * sweeps type by type: every AnimationComponent, then every PaletteSwap, and so on,
+ * instead of jumping between unrelated virtual calls entity by entity.
+ *
+ * Components registered since the last TakeAdded() are kept in a separate list
+ * so the battle scene only injects new components instead of scanning every entity.
+ *
+ * Components unregister themselves when they are destroyed or freed from their owner.
+ */
+class ComponentRegistry {
+public:
+  ComponentRegistry();
+
+  /**
+   * @brief Releases the components still registered. Does not delete them.
+   */
+  ~ComponentRegistry();
+
+  ComponentRegistry(const ComponentRegistry&) = delete;
+  ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+
+  /**
+   * @brief Files the component under its type and queues it for injection
+   *
+   * Does nothing if the component is already registered
+   */
+  void Add(Component* component);
+
+  /**
+   * @brief Stops scheduling the component. Safe to call during Update().
+   */
+  void Remove(Component* component);
+
+  /**
+   * @brief Updates every registered component whose owner is on a tile, one type at a time
+   * @param _elapsed in seconds
+   */
+  void Update(float _elapsed);
+
+  /**
+   * @brief Moves the components added since the last call into out
+   * @param out cleared first
+   */
+  void TakeAdded(std::vector<Component*>& out);
+
+  /**
+   * @brief Forgets the components added so far. For runs without a scene to inject into.
+   */
+  void ClearAdded();
+
+  /**
+   * @brief Number of registered components
+   */
+  const size_t GetCount() const;
+
+private:
+  struct Bucket {
+    std::type_index type;
+    std::vector<Component*> components; /*!< May hold nulls while an update is running */
+  };
+
+  /**
+   * @brief Removes the nulls left by components removed during Update()
+   */
+  void Compact();
+
+  std::vector<Bucket> buckets; /*!< In the order each type was first seen */
+  std::unordered_map<std::type_index, size_t> bucketOf; /*!< Type -> index into buckets */
+  std::vector<Component*> added; /*!< Registered since the last TakeAdded() */
+  size_t count;
+  bool isUpdating;
+  bool hasHoles; /*!< Something was removed mid update */
+};
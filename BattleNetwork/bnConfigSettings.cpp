@@ -1,5 +1,6 @@
 #include "bnConfigSettings.h"
 #include "bnLogger.h"
+#include <algorithm>
 
 /**
  * @brief If config file is ok
@@ -33,19 +34,20 @@ void ConfigSettings::SetSFXLevel(int level)
   sfxLevel = level;
 }
 
-const std::list<std::string> ConfigSettings::GetPairedActions(sf::Keyboard::Key event) {
-  std::list<std::string> list;
+const InputActions ConfigSettings::GetPairedActions(sf::Keyboard::Key event) {
+  InputActions actions;
 
-  decltype(keyboard)::iterator iter = keyboard.begin();
+  auto range = keyboard.equal_range(event);
 
-  while (iter != keyboard.end()) {
-    if (iter->first == event) {
-      list.push_back(iter->second);
+  for (auto iter = range.first; iter != range.second; iter++) {
+    InputAction action = FindAction(iter->second);
+
+    if (action != InputAction::SIZE) {
+      actions.set((size_t)action);
     }
-    iter++;
   }
 
-  return list;
+  return actions;
 }
 
 const sf::Keyboard::Key ConfigSettings::GetPairedInput(std::string action)
@@ -86,21 +88,30 @@ const Gamepad ConfigSettings::GetPairedGamepadButton(std::string action)
   return (Gamepad) - 1;
 }
 
-const std::list<std::string> ConfigSettings::GetPairedActions(Gamepad event) {
-  std::list<std::string> list;
+const InputActions ConfigSettings::GetPairedActions(Gamepad event) {
+  InputActions actions;
+
+  auto range = gamepad.equal_range(event);
+
+  for (auto iter = range.first; iter != range.second; iter++) {
+    InputAction action = FindAction(iter->second);
 
-  if (gamepad.size()) {
-    decltype(gamepad)::iterator iter = gamepad.begin();
+    if (action != InputAction::SIZE) {
+      actions.set((size_t)action);
+    }
+  }
+
+  return actions;
+}
 
-    while (iter != gamepad.end()) {
-      if (iter->first == event) {
-        list.push_back(iter->second);
-      }
-      iter++;
+InputAction ConfigSettings::FindAction(const std::string& name) {
+  for (size_t i = 0; i < (size_t)InputAction::SIZE; i++) {
+    if (EventTypes::KEYS[i] == name) {
+      return (InputAction)i;
     }
   }
 
-  return list;
+  return InputAction::SIZE;
 }
 
 ConfigSettings & ConfigSettings::operator=(ConfigSettings rhs)
@@ -4,6 +4,7 @@
 #include <list>
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Joystick.hpp>
+#include "bnInputEvent.h"
 
 struct DiscordInfo {
   std::string user;
@@ -38,11 +39,13 @@ public:
   void SetMusicLevel(int level);
   void SetSFXLevel(int level);
   /**
-   * @brief For a keyboard event, return the action string
+   * @brief For a keyboard event, return the bound actions
    * @param event sfml keyboard key
-   * @return the mapped input event
+   * @return one bit per action bound to the key
+   * 
+   * This is where config action names become InputActions. Call it when the settings change, not per frame.
    */
-  const std::list<std::string> GetPairedActions(sf::Keyboard::Key event);
+  const InputActions GetPairedActions(sf::Keyboard::Key event);
 
   /**
  * @brief For an action string, return the bound keyboard key
@@ -59,11 +62,18 @@ public:
   const Gamepad GetPairedGamepadButton(std::string action);
 
   /**
-   * @brief For a gamepad event, return the action string
+   * @brief For a gamepad event, return the bound actions
    * @param Gamepad button
-   * @return list of the mapped input events
+   * @return one bit per action bound to the button
    */
-  const std::list<std::string> GetPairedActions(Gamepad event);
+  const InputActions GetPairedActions(Gamepad event);
+
+  /**
+   * @brief Finds the action with the config name
+   * @param name as written in EventTypes::KEYS
+   * @return the action or InputAction::SIZE if no action has that name
+   */
+  static InputAction FindAction(const std::string& name);
 
   ConfigSettings& operator=(ConfigSettings rhs);
 
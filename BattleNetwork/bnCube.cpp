@@ -115,14 +115,14 @@ void Cube::OnDelete() {
   delete virusBody;
 
   if (this->GetFirstComponent<AnimationComponent>()->GetAnimationString() != "APPEAR") {
-    int intensity = rand() % 2;
+    int intensity = GetField()->GetRandom().Next(2);
     intensity += 1;
 
     auto left = (this->GetElement() == Element::ICE) ? RockDebris::Type::LEFT_ICE : RockDebris::Type::LEFT;
     this->GetField()->AddEntity(*new RockDebris(left, (double)intensity), *this->GetTile());
 
 
-    intensity = rand() % 3;
+    intensity = GetField()->GetRandom().Next(3);
     intensity += 1;
     auto right = (this->GetElement() == Element::ICE) ? RockDebris::Type::RIGHT_ICE : RockDebris::Type::RIGHT;
     this->GetField()->AddEntity(*new RockDebris(right, (double)intensity), *this->GetTile());
@@ -184,7 +184,7 @@ const bool Cube::OnHit(const Hit::Properties props) {
 }
 
 void Cube::Attack(Character* other) {
-  Obstacle* isObstacle = dynamic_cast<Obstacle*>(other);
+  Obstacle* isObstacle = other->As<Obstacle>();
 
   if (isObstacle) {
     // breaking prop is insta-kill
@@ -24,7 +24,7 @@ void CustEmblem::CreateWireEffect() {
   // Note: when index is equal to the following [2,9,10], the shader breaks and looks ugly. 
   // Skip those values.
   do {
-    w.index = rand() % numWires;
+    w.index = random.Next(numWires);
   } while (w.index == 2 || w.index == 9 || w.index == 10);
 
   w.progress = 0;
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include "bnTextureResourceManager.h"
 #include "bnShaderResourceManager.h"
+#include "bnRandom.h"
 
 /**
  * @class CustEmblem
@@ -33,6 +34,7 @@ private:
   };
 
   int numWires; /*!< How many wires the emblem has */
+  Random random; /*!< Picks the next wire */
 
   std::deque<WireEffect> coming; /*!< List of wires moving forward */
   std::deque<WireEffect> leaving; /*!< List of wires reversed */
@@ -17,7 +17,8 @@
 ElecSwordChipAction::ElecSwordChipAction(Character * owner, int damage) : SwordChipAction(owner, damage) {
   this->damage = damage;
 
-  overlay.setTexture(*TextureResourceManager::GetInstance().LoadTextureFromFile(PATH));
+  overlayTexture = TextureResourceManager::GetInstance().LoadTextureFromFile(PATH);
+  overlay.setTexture(*overlayTexture);
   attachmentAnim = Animation(ANIM);
   attachmentAnim.Reload();
   attachmentAnim.SetAnimation("DEFAULT");
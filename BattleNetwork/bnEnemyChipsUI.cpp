@@ -29,7 +29,7 @@ void EnemyChipsUI::OnUpdate(float _elapsed) {
 
     if (agent && agent->GetTarget() && !agent->GetTarget()->IsDeleted() && agent->GetTarget()->GetTile()) {
       if (agent->GetTarget()->GetTile()->GetY() == GetOwner()->GetTile()->GetY()) {
-        if (rand() % 500 > 299) {
+        if (GetOwner()->GetField()->GetRandom().Next(500) > 299) {
           this->UseNextChip();
         }
       }
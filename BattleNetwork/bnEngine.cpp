@@ -1,10 +1,11 @@
 #include "bnEngine.h"
-#include <time.h>       /* time */
 #include <SFML/Window/ContextSettings.hpp>
 
 #include "mmbn.ico.c"
 #include "bnShaderType.h"
 #include "bnShaderResourceManager.h"
+#include "bnProfiler.h"
+#include "bnPostProcessGraph.h"
 
 Engine& Engine::GetInstance() {
   static Engine instance;
@@ -29,18 +30,20 @@ void Engine::Initialize() {
 
   this->Resize((int)view.getSize().x, (int)view.getSize().y);
 
-  window->setFramerateLimit(60);
+  // The game loop runs fixed simulation ticks and draws as fast as the display refreshes
+  window->setVerticalSyncEnabled(true);
   // window->setMouseCursorVisible(false); // Hide cursor
 
   window->setIcon(sfml_icon.width, sfml_icon.height, sfml_icon.pixel_data);
-
-  // See the random generator with current time
-  srand((unsigned int)time(0));
 }
 
 void Engine::Draw(Drawable& _drawable, bool applyShaders) {
+  PROFILE_ZONE("Engine::Draw");
+
   if (!HasRenderSurface()) return;
 
+  batch.Flush();
+
   if (applyShaders) {
     auto stateCopy = state;
 
@@ -57,12 +60,16 @@ void Engine::Draw(Drawable& _drawable, bool applyShaders) {
 }
 
 void Engine::Draw(Drawable* _drawable, bool applyShaders) {
+  PROFILE_ZONE("Engine::Draw");
+
   if (!HasRenderSurface()) return;
 
   if (!_drawable) {
     return;
   }
 
+  batch.Flush();
+
   if (applyShaders) {
     auto stateCopy = state;
 
@@ -79,6 +86,8 @@ void Engine::Draw(Drawable* _drawable, bool applyShaders) {
 }
 
 void Engine::Draw(SpriteSceneNode* _drawable) {
+  PROFILE_ZONE("Engine::Draw");
+
   if (!HasRenderSurface()) return;
 
   // For now, support at most one shader.
@@ -87,8 +96,13 @@ void Engine::Draw(SpriteSceneNode* _drawable) {
   SpriteSceneNode* context = _drawable;
   SmartShader* shader = &context->GetShader();
 
+  if (batch.IsActive()) {
+    BatchNode(context);
+    return;
+  }
+
   if (shader && shader->Get()) {
-    const sf::Texture* original = context->getTexture();
+    // Only uniforms that differ from what the program holds are uploaded
     shader->ApplyUniforms();
 
     sf::RenderStates newState = state;
@@ -96,7 +110,6 @@ void Engine::Draw(SpriteSceneNode* _drawable) {
 
     context->draw(*surface, newState);
     // surface->draw(*context, newState); // bake
-    shader->ResetUniforms();
   } else {
     context->draw(*surface, state);
   }
@@ -106,34 +119,17 @@ void Engine::Draw(vector<SpriteSceneNode*> _drawable) {
 
   auto it = _drawable.begin();
   for (it; it != _drawable.end(); ++it) {
-    /*
-    NOTE: Could add support for multiple shaders:
-    sf::RenderTexture image1;
-    sf::RenderTexture image2;
-
-    sf::RenderTexture* front = &image1;
-    sf::RenderTexture* back = &image2;
-
-    // draw the initial scene into "back"
-    ...
-
-    for (std::vector<sf::Shader>::iterator it = shaders.begin(); it != shaders.end(); ++it)
-    {
-    // draw "back" into "front"
-    front->clear();
-    front->draw(sf::Sprite(back->getTexture()), &*it);
-    front->display();
-
-    // swap front and back buffers
-    std::swap(back, front)
-    }
-
-    */
+    // One shader per node. Full screen effects that chain shaders go through PostProcess()
 
-    // For now, support at most one shader.
-    // Grab the shader and image, apply to a new render target, pass this render target into Draw()
+    PROFILE_ZONE("Engine::Draw");
 
     SpriteSceneNode* context = *it;
+
+    if (batch.IsActive()) {
+      BatchNode(context);
+      continue;
+    }
+
     SmartShader& shader = context->GetShader();
     if (shader.Get() != nullptr) {
       shader.ApplyUniforms();
@@ -144,8 +140,6 @@ void Engine::Draw(vector<SpriteSceneNode*> _drawable) {
       context->draw(*surface, newState);
 
       //surface->draw(*context, newState); // bake
-
-      shader.ResetUniforms();
     } else {
       context->draw(*surface, state);
     }
@@ -161,6 +155,96 @@ void Engine::Draw(vector<Drawable*> _drawable, bool applyShaders) {
   }
 }
 
+void Engine::DrawBatched(const sf::Sprite& sprite, const sf::Shader* shader) {
+  PROFILE_ZONE("Engine::Draw");
+
+  if (!HasRenderSurface()) return;
+
+  sf::RenderStates newState = state;
+
+  if (shader) {
+    newState.shader = shader;
+  }
+
+#ifdef __ANDROID__
+  if (!newState.shader) {
+    newState.shader = SHADERS.GetShader(ShaderType::DEFAULT);
+  }
+#endif
+
+  if (batch.IsActive()) {
+    batch.Draw(sprite, newState);
+  } else {
+    surface->draw(sprite, newState);
+  }
+}
+
+const bool Engine::SharesDrawState(const SpriteSceneNode& a, const SpriteSceneNode& b) {
+  return a.GetShader().Get() == b.GetShader().Get() && a.getTexture() == b.getTexture();
+}
+
+static const bool AddDrawBounds(const SceneNode& node, const sf::Transform& parent, sf::FloatRect& bounds) {
+  const SpriteSceneNode* sprite = dynamic_cast<const SpriteSceneNode*>(&node);
+
+  if (!sprite) return false;
+
+  sf::Transform transform = parent * sprite->getTransform();
+  sf::FloatRect area = transform.transformRect(sprite->getSprite().getLocalBounds());
+
+  float left = std::min(bounds.left, area.left);
+  float top = std::min(bounds.top, area.top);
+  float right = std::max(bounds.left + bounds.width, area.left + area.width);
+  float bottom = std::max(bounds.top + bounds.height, area.top + area.height);
+
+  bounds = sf::FloatRect(left, top, right - left, bottom - top);
+
+  for (auto child : sprite->GetChildNodes()) {
+    if (!AddDrawBounds(*child, transform, bounds)) return false;
+  }
+
+  return true;
+}
+
+const bool Engine::GetDrawBounds(const SpriteSceneNode& node, sf::FloatRect& bounds) {
+  sf::Transform transform = node.getTransform();
+  bounds = transform.transformRect(node.getSprite().getLocalBounds());
+
+  for (auto child : node.GetChildNodes()) {
+    if (!AddDrawBounds(*child, transform, bounds)) return false;
+  }
+
+  return true;
+}
+
+void Engine::BatchNode(SpriteSceneNode* context) {
+  SmartShader& shader = context->GetShader();
+  sf::RenderStates newState = state;
+
+  if (shader.Get()) {
+    newState.shader = shader.Get();
+
+    // Uniforms are applied when the batch flushes, not now
+    batch.SetUniforms(shader.HasUniforms() ? &shader : nullptr);
+  }
+
+  context->DrawBatched(batch, newState);
+  batch.SetUniforms(nullptr);
+}
+
+void Engine::BeginBatch() {
+  if (!HasRenderSurface()) return;
+
+  batch.Begin(*surface);
+}
+
+void Engine::EndBatch() {
+  batch.End();
+}
+
+const SpriteBatch& Engine::GetSpriteBatch() const {
+  return batch;
+}
+
 bool Engine::Running() {
   return window->isOpen();
 }
@@ -179,14 +263,65 @@ RenderWindow* Engine::GetWindow() const {
 
 Engine::Engine()
 {
-
+  window = nullptr;
+  surface = nullptr;
   cam = new Camera(view);
+  interpolationAlpha = 1.f;
 }
 
 Engine::~Engine() {
   delete window;
 }
 
+sf::RenderTexture* Engine::AcquireRenderTarget(const sf::Vector2u& size) {
+  return targets.Acquire(size);
+}
+
+sf::RenderTexture* Engine::AcquireRenderTarget() {
+  if (HasRenderSurface()) {
+    return targets.Acquire(surface->getSize());
+  }
+
+  return targets.Acquire(sf::Vector2u((unsigned)view.getSize().x, (unsigned)view.getSize().y));
+}
+
+void Engine::ReleaseRenderTarget(sf::RenderTexture* target) {
+  if (!target) return;
+
+  // The pool may recreate the target at another size. Do not keep drawing into it.
+  if (batch.GetTarget() == target) {
+    batch.End();
+  }
+
+  if (surface == target) {
+    surface = nullptr;
+  }
+
+  targets.Release(target);
+}
+
+void Engine::PostProcess(PostProcessGraph& graph) {
+  PROFILE_ZONE("Engine::PostProcess");
+
+  if (!HasRenderSurface() || !graph.HasEnabledPasses()) return;
+
+  batch.Flush();
+
+  graph.Run(*surface);
+}
+
+const RenderTargetPool& Engine::GetRenderTargetPool() const {
+  return targets;
+}
+
+void Engine::SetInterpolationAlpha(float alpha) {
+  interpolationAlpha = alpha;
+}
+
+const float Engine::GetInterpolationAlpha() const {
+  return interpolationAlpha;
+}
+
 const sf::Vector2f Engine::GetViewOffset() {
   return GetView().getCenter() - cam->GetView().getCenter();
 }
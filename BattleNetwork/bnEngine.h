@@ -1,5 +1,6 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <algorithm>
 #include <vector>
 
 using sf::Drawable;
@@ -10,6 +11,10 @@ using std::vector;
 
 #include "bnCamera.h"
 #include "bnLayered.h"
+#include "bnSpriteBatch.h"
+#include "bnRenderTargetPool.h"
+
+class PostProcessGraph;
 
 /**
  * @class Engine
@@ -62,6 +67,58 @@ public:
    * @param _drawable vector of SpriteSceneNode*
    */
   void Draw(vector<SpriteSceneNode*> _drawable);
+
+  /**
+   * @brief Puts nodes in draw order: highest layer first, then grouped by shader and texture
+   * @param nodes in position order, which breaks ties
+   *
+   * Within a layer, a node moves up behind an earlier one with the same shader and
+   * texture only if it overlaps none of the nodes it jumps over, so the picture is
+   * the same as drawing in position order. Swapping a shader in never reorders
+   * draws that overlap.
+   */
+  template<typename T>
+  static void SortDrawOrder(vector<T*>& nodes);
+
+  /**
+   * @brief Query if both nodes draw with the same shader and texture
+   */
+  static const bool SharesDrawState(const SpriteSceneNode& a, const SpriteSceneNode& b);
+
+  /**
+   * @brief Area covered by a node and its sprite children, before the draw offset
+   * @param bounds set to the area
+   * @return false if a child is not a sprite and its area is unknown
+   */
+  static const bool GetDrawBounds(const SpriteSceneNode& node, sf::FloatRect& bounds);
+
+  /**
+   * @brief Draw a plain sprite through the engine pipeline with an optional shader
+   * @param sprite
+   * @param shader applied on top of the engine state if non null
+   *
+   * Between BeginBatch() and EndBatch() the sprite is added to the sprite batch
+   */
+  void DrawBatched(const sf::Sprite& sprite, const sf::Shader* shader = nullptr);
+
+  /**
+   * @brief Batch sprites and SpriteSceneNodes drawn to the render surface until EndBatch()
+   *
+   * Any other draw call through the engine flushes the batch first so draw order is kept.
+   * Drawing to the surface directly while batching skips the batch, call EndBatch() first.
+   */
+  void BeginBatch();
+
+  /**
+   * @brief Flushes the sprite batch and goes back to one draw call per sprite
+   */
+  void EndBatch();
+
+  /**
+   * @brief Fetch the sprite batch for draw call statistics
+   * @return const SpriteBatch&
+   */
+  const SpriteBatch& GetSpriteBatch() const;
   
   /**
    * @brief Returns true if the window is open
@@ -160,6 +217,55 @@ public:
     return *surface;
   }
 
+  /**
+   * @brief Borrow a pooled render target, cleared to transparent
+   * @param size in pixels
+   * @return sf::RenderTexture* give it back with ReleaseRenderTarget()
+   *
+   * Use this instead of copying the render surface into a new sf::Texture
+   */
+  sf::RenderTexture* AcquireRenderTarget(const sf::Vector2u& size);
+
+  /**
+   * @brief Borrow a pooled render target the size of the render surface, or of the view if there is none
+   */
+  sf::RenderTexture* AcquireRenderTarget();
+
+  /**
+   * @brief Return a render target borrowed with AcquireRenderTarget()
+   * @param target ignored if null
+   *
+   * If the target is the render surface, e.g. a segue drew a scene into it,
+   * the engine is left without a surface until the next SetRenderSurface()
+   */
+  void ReleaseRenderTarget(sf::RenderTexture* target);
+
+  /**
+   * @brief Runs the graph's passes over everything drawn to the render surface so far
+   * @param graph
+   *
+   * Flushes the sprite batch first. Does nothing if no pass is enabled.
+   */
+  void PostProcess(PostProcessGraph& graph);
+
+  /**
+   * @brief Fetch the render target pool for statistics
+   * @return const RenderTargetPool&
+   */
+  const RenderTargetPool& GetRenderTargetPool() const;
+
+  /**
+   * @brief How far the frame being drawn is between the last simulation tick and the next
+   * @param alpha in [0, 1]. Set by the game loop before drawing.
+   */
+  void SetInterpolationAlpha(float alpha);
+
+  /**
+   * @brief Used to interpolate entity positions when drawing
+   * @return 1 unless the game loop has set it
+   */
+  const float GetInterpolationAlpha() const;
+
   // TODO: make this private again
   const sf::Vector2f GetViewOffset(); // for drawing 
 private:
@@ -172,15 +278,50 @@ private:
     * @brief deletes the window */
   ~Engine();
 
+  /**
+   * @brief Adds a SpriteSceneNode and its children to the sprite batch
+   * @param context
+   */
+  void BatchNode(SpriteSceneNode* context);
+
   RenderWindow* window; /*!< Window created when app launches */
   sf::View view; /*!< Default view created when window launches */
   sf::View original; /*!< Default view created when window launches */
   sf::RenderStates state; /*!< Global GL context information used when drawing*/
   sf::RenderTexture* surface; /*!< The external buffer to draw to */
   Camera* cam; /*!< Camera object */
+  SpriteBatch batch; /*!< Merges consecutive sprites with the same render states */
+  RenderTargetPool targets; /*!< Screen sized targets for segues and post effects */
+  float interpolationAlpha; /*!< Fraction of a tick the frame being drawn is ahead of the last update */
 
 };
 
+template<typename T>
+inline void Engine::SortDrawOrder(vector<T*>& nodes) {
+  std::stable_sort(nodes.begin(), nodes.end(), [](const T* a, const T* b) { return a->GetLayer() > b->GetLayer(); });
+
+  sf::FloatRect bounds, other;
+
+  for (size_t i = 0; i + 1 < nodes.size(); i++) {
+    size_t next = i + 1; /* where the next node of this group goes */
+
+    for (size_t j = next; j < nodes.size() && nodes[j]->GetLayer() == nodes[i]->GetLayer(); j++) {
+      if (!SharesDrawState(*nodes[i], *nodes[j])) continue;
+
+      bool blocked = j > next && !GetDrawBounds(*nodes[j], bounds);
+
+      for (size_t k = next; k < j && !blocked; k++) {
+        blocked = !GetDrawBounds(*nodes[k], other) || bounds.intersects(other);
+      }
+
+      if (blocked) continue;
+
+      std::rotate(nodes.begin() + next, nodes.begin() + j, nodes.begin() + j + 1);
+      next++;
+    }
+  }
+}
+
 /**
  * @brief Shorter to type. Fetches instance of singleton.
  */
@@ -3,6 +3,11 @@
 #include "bnTile.h"
 #include "bnField.h"
 #include <Swoosh/Ease.h>
+#include <algorithm>
+#include <cmath>
+
+// Half a tile. Moves further than this in one tick are not interpolated.
+#define INTERPOLATE_MAX_DISTANCE 40.0f
 
 long Entity::numOfIDs = 0;
 
@@ -26,8 +31,10 @@ Entity::Entity()
   slideTime(sf::milliseconds(100)),
   defaultSlideTime(slideTime),
   elapsedSlideTime(0),
-  lastComponentID(0),
-  height(0)
+  height(0),
+  kind(0),
+  kindRefs{},
+  recordedTicks(0)
 {
   this->ID = ++Entity::numOfIDs;
   alpha = 255;
@@ -52,6 +59,10 @@ void Entity::Spawn(Battle::Tile & start)
   this->hasSpawned = true;
 }
 
+const bool Entity::IsKind(EntityKind flags) const {
+  return (kind & static_cast<unsigned>(flags)) == static_cast<unsigned>(flags);
+}
+
 const float Entity::GetHeight() const {
   return height;
 }
@@ -87,8 +98,10 @@ void Entity::Update(float _elapsed) {
     }
   }*/
 
-  // Update all components
+  // Components of entities on the field are updated by the field's registry
   for (int i = 0; i < components.size(); i++) {
+    if (components[i]->IsScheduled()) continue;
+
     components[i]->OnUpdate(_elapsed);
   }
 
@@ -350,6 +363,11 @@ Team Entity::GetTeam() const {
 }
 void Entity::SetTeam(Team _team) {
   team = _team;
+
+  // keep the field's team buckets in sync
+  if (field) {
+    field->ReindexEntityTeam(*this);
+  }
 }
 
 void Entity::SetPassthrough(bool state)
@@ -486,6 +504,11 @@ Component* Entity::RegisterComponent(Component* c) {
   // Newest components appear first in the list for easy referencing
   std::sort(components.begin(), components.end(), [](Component* a, Component* b) { return a->GetID() > b->GetID(); });
 
+  // Already on the field. Otherwise the field registers it when this entity is placed.
+  if (field && tile) {
+    field->GetComponentRegistry().Add(c);
+  }
+
   return c;
 }
 
@@ -504,3 +527,23 @@ const int Entity::GetMoveCount() const
 {
     return this->moveCount;
 }
+
+void Entity::RecordTickPosition() {
+  tickPosition[0] = recordedTicks ? tickPosition[1] : getPosition();
+  tickPosition[1] = getPosition();
+  recordedTicks = std::min(recordedTicks + 1, 2);
+}
+
+const sf::Vector2f Entity::GetInterpolatedOffset(float alpha) const {
+  if (recordedTicks < 2) return sf::Vector2f(0, 0);
+
+  sf::Vector2f delta = tickPosition[1] - tickPosition[0];
+
+  // Tile to tile moves are teleports. Drawing them halfway looks like a smear.
+  if (std::fabs(delta.x) > INTERPOLATE_MAX_DISTANCE || std::fabs(delta.y) > INTERPOLATE_MAX_DISTANCE) {
+    return sf::Vector2f(0, 0);
+  }
+
+  sf::Vector2f drawn = tickPosition[0] + delta * alpha;
+  return drawn - tickPosition[1];
+}
@@ -33,19 +33,69 @@ namespace Battle {
 
 class Field;
 class BattleScene; // forward decl
+class Character;
+class Spell;
+class Obstacle;
+class Artifact;
+class Player;
+class Agent;
+
+/**
+ * @brief Bit flags for the entity types queried every frame in battle
+ * 
+ * Each base type tags itself on construction so type checks on the hot path
+ * are a bitmask test instead of a dynamic_cast through the virtual Entity base
+ */
+enum class EntityKind : unsigned {
+  none      = 0,
+  character = 1 << 0,
+  spell     = 1 << 1,
+  obstacle  = 1 << 2,
+  artifact  = 1 << 3,
+  player    = 1 << 4,
+  agent     = 1 << 5
+};
+
+constexpr int EntityKindCount = 6;
+
+/**
+ * @brief Maps a type to its EntityKind flag. Untagged types are EntityKind::none and use RTTI.
+ */
+template<typename T> struct EntityKindOf { static constexpr EntityKind value = EntityKind::none; };
+template<> struct EntityKindOf<Character> { static constexpr EntityKind value = EntityKind::character; };
+template<> struct EntityKindOf<Spell> { static constexpr EntityKind value = EntityKind::spell; };
+template<> struct EntityKindOf<Obstacle> { static constexpr EntityKind value = EntityKind::obstacle; };
+template<> struct EntityKindOf<Artifact> { static constexpr EntityKind value = EntityKind::artifact; };
+template<> struct EntityKindOf<Player> { static constexpr EntityKind value = EntityKind::player; };
+template<> struct EntityKindOf<Agent> { static constexpr EntityKind value = EntityKind::agent; };
+
+/**
+ * @brief Bit position of a single EntityKind flag
+ */
+constexpr int EntityKindIndex(EntityKind kind) {
+  int index = 0;
+  unsigned bits = static_cast<unsigned>(kind);
+
+  while (bits > 1) { bits >>= 1; index++; }
+
+  return index;
+}
 
 class Entity : public SpriteSceneNode {
   friend class Field;
   friend class Component;
   friend class BattleScene;
+  template<typename CharacterT> friend class AI;
+  template<typename CharacterT> friend class BossPatternAI;
 
 private:
   long ID;              /*!< IDs are used for tagging during battle & to identify entities in scripting. */
   static long numOfIDs; /*!< Internal counter to identify the next entity with. */
   int alpha;            /*!< Control the transparency of an entity. */
-  long lastComponentID; /*!< Entities keep track of new components to run through scene injection later. */
   bool hasSpawned;      /*!< Flag toggles true when the entity is first placed onto the field. Calls OnSpawn(). */
   float height;         /*!< Height of the entity relative to tile floor. Used for visual effects like projectiles or for hitbox detection*/
+  unsigned kind;        /*!< EntityKind flags set by each tagged base type */
+  void* kindRefs[EntityKindCount]; /*!< `this` as seen by each tagged base type. Virtual inheritance forbids static downcasts. */
 public:
 
   Entity();
@@ -323,12 +373,27 @@ public:
 
   /**
   * @brief Check if entity is a specialized type
+  * Tagged types (@see EntityKind) are a bitmask test, otherwise falls back to dynamic_cast
   * @return true if entity could be dynamically casted to Type
   * @warning dynamic casts are costly! Avoid if possible!
   */
   template<typename Type>
   bool IsA();
 
+  /**
+  * @brief Cast the entity to a specialized type
+  * Tagged types (@see EntityKind) are looked up without RTTI, otherwise falls back to dynamic_cast
+  * @return Type* or null if the entity is not a Type
+  */
+  template<typename Type>
+  Type* As();
+
+  /**
+  * @brief Query the EntityKind flags this entity was tagged with
+  * @return true if all bits in `flags` are set
+  */
+  const bool IsKind(EntityKind flags) const;
+
   /**
    * @brief Attaches a component to an entity
    * @param c the component to add 
@@ -363,6 +428,20 @@ public:
   */
   void FinishMove();
 
+  /**
+   * @brief Remembers where the entity was at the end of the last two simulation ticks
+   * 
+   * The field calls this after every update
+   */
+  void RecordTickPosition();
+
+  /**
+   * @brief Offset from the current position to draw the entity between the last two ticks
+   * @param alpha 0 draws at the previous tick, 1 draws at the latest tick
+   * @return zero if the entity jumped further than INTERPOLATE_MAX_DISTANCE or has not been ticked
+   */
+  const sf::Vector2f GetInterpolatedOffset(float alpha) const;
+
 protected:
   Battle::Tile* next; /**< Pointer to the next tile */
   Battle::Tile* tile; /**< Current tile pointer */
@@ -379,6 +458,13 @@ protected:
 
   const int GetMoveCount() const; /*!< Total intended movements made. Used to calculate rank*/
 
+  /**
+   * @brief Tagged base types call this in their constructor with `this`
+   * @param self the entity as seen by Type
+   */
+  template<typename Type>
+  void Tag(Type* self);
+
 private:
   bool isBattleActive;
   bool ownedByField; /*!< Must delete the entity manual if not owned by the field. */
@@ -393,6 +479,8 @@ private:
   double elapsedSlideTime; /*!< When elapsedSlideTime is equal to slideTime, slide is over */
   Direction direction;
   Direction previousDirection;
+  sf::Vector2f tickPosition[2]; /*!< Positions at the end of the previous and latest ticks */
+  int recordedTicks; /*!< How many of tickPosition are valid */
 
     /**
    * @brief Used internally before moving and updates the start position vector used in the sliding motion
@@ -435,7 +523,7 @@ inline std::vector<BaseType*> Entity::GetComponentsDerivedFrom()
   auto res = std::vector<BaseType*>();
 
   for (vector<Component*>::iterator it = components.begin(); it != components.end(); ++it) {
-    BaseType* cast = dynamic_cast<BaseType*>(*it);
+    BaseType* cast = (*it)->template As<BaseType>();
 
     if (cast) {
       res.push_back(cast);
@@ -447,5 +535,33 @@ inline std::vector<BaseType*> Entity::GetComponentsDerivedFrom()
 
 template<typename Type>
 inline bool Entity::IsA() {
-  return (dynamic_cast<Type*>(this) != nullptr);
+  constexpr EntityKind flag = EntityKindOf<Type>::value;
+
+  if constexpr (flag == EntityKind::none) {
+    return (dynamic_cast<Type*>(this) != nullptr);
+  }
+  else {
+    return IsKind(flag);
+  }
+}
+
+template<typename Type>
+inline Type* Entity::As() {
+  constexpr EntityKind flag = EntityKindOf<Type>::value;
+
+  if constexpr (flag == EntityKind::none) {
+    return dynamic_cast<Type*>(this);
+  }
+  else {
+    return static_cast<Type*>(kindRefs[EntityKindIndex(flag)]);
+  }
+}
+
+template<typename Type>
+inline void Entity::Tag(Type* self) {
+  constexpr EntityKind flag = EntityKindOf<Type>::value;
+  static_assert(flag != EntityKind::none, "Type must have an EntityKind to be tagged");
+
+  kind |= static_cast<unsigned>(flag);
+  kindRefs[EntityKindIndex(flag)] = self;
 }
\ No newline at end of file
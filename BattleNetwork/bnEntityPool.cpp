@@ -0,0 +1,106 @@
+#include "bnEntityPool.h"
+
+#include <new>
+
+namespace {
+  constexpr std::size_t GRANULARITY = 64; /*!< Size classes are multiples of this */
+  constexpr std::size_t MAX_POOLED_SIZE = 8192; /*!< Larger entities go straight to the heap */
+  constexpr std::size_t CLASS_COUNT = MAX_POOLED_SIZE / GRANULARITY;
+
+  struct Block {
+    Block* next;
+  };
+
+  // Plain pointers so the lists need no destructor and stay valid during static teardown
+  struct FreeList {
+    Block* head;
+    std::size_t count;
+  };
+
+  thread_local FreeList lists[CLASS_COUNT];
+
+  /**
+   * @brief Releases the calling thread's lists when the thread exits
+   *
+   * Touched on every Free() so the destructor is registered on threads that cached a block
+   */
+  struct ThreadExit {
+    bool exited = false; /*!< Lists were released. Later frees skip them. */
+
+    ~ThreadExit() {
+      EntityPool::Release();
+      exited = true;
+    }
+  };
+
+  thread_local ThreadExit threadExit;
+
+  inline std::size_t ClassOf(std::size_t size) {
+    return (size + GRANULARITY - 1) / GRANULARITY - 1;
+  }
+}
+
+void* EntityPool::Allocate(std::size_t size) {
+  if (size == 0 || size > MAX_POOLED_SIZE) {
+    return ::operator new(size);
+  }
+
+  std::size_t index = ClassOf(size);
+  FreeList& list = lists[index];
+
+  if (list.head) {
+    Block* block = list.head;
+    list.head = block->next;
+    list.count--;
+    return block;
+  }
+
+  // Round up so any entity in this class can take the block later
+  return ::operator new((index + 1) * GRANULARITY);
+}
+
+void EntityPool::Free(void* ptr, std::size_t size) {
+  if (!ptr) return;
+
+  if (size == 0 || size > MAX_POOLED_SIZE) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  if (threadExit.exited) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  FreeList& list = lists[ClassOf(size)];
+
+  Block* block = static_cast<Block*>(ptr);
+  block->next = list.head;
+  list.head = block;
+  list.count++;
+}
+
+void EntityPool::Release() {
+  for (std::size_t i = 0; i < CLASS_COUNT; i++) {
+    Block* block = lists[i].head;
+
+    while (block) {
+      Block* next = block->next;
+      ::operator delete(block);
+      block = next;
+    }
+
+    lists[i].head = nullptr;
+    lists[i].count = 0;
+  }
+}
+
+const std::size_t EntityPool::GetCachedBytes() {
+  std::size_t bytes = 0;
+
+  for (std::size_t i = 0; i < CLASS_COUNT; i++) {
+    bytes += lists[i].count * (i + 1) * GRANULARITY;
+  }
+
+  return bytes;
+}
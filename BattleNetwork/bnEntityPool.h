@@ -0,0 +1,45 @@
+/*! \file bnEntityPool.h */
+
+/*! \brief Recycles the memory of short lived battle entities
+ *
+ * Every attack spawns spells and hit effects that live for a handful of frames.
+ * Spell and Artifact route their operator new and delete through here so a freed
+ * entity's block goes onto a free list instead of back to the heap, and the next
+ * entity of the same size takes it. Blocks are grouped by size class so in practice
+ * each entity type gets its own list.
+ *
+ * Lists are per thread so simulations on worker threads never contend.
+ * Entities still alive are untouched by Release(), their blocks are cached
+ * again when they are deleted. A thread's lists are released when it exits,
+ * and blocks freed on it after that go straight back to the heap.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+class EntityPool {
+public:
+  /**
+   * @brief Takes a cached block of at least size bytes or allocates a new one
+   */
+  static void* Allocate(std::size_t size);
+
+  /**
+   * @brief Caches the block for the next entity of the same size class
+   * @param size must be the size it was allocated with
+   */
+  static void Free(void* ptr, std::size_t size);
+
+  /**
+   * @brief Returns every block cached by the calling thread to the heap
+   *
+   * Call at battle end once the field has deleted its entities
+   */
+  static void Release();
+
+  /**
+   * @brief Bytes cached by the calling thread and waiting for reuse
+   */
+  static const std::size_t GetCachedBytes();
+};
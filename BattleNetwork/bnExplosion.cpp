@@ -127,14 +127,14 @@ void Explosion::SetOffsetArea(sf::Vector2f area)
 
   this->offsetArea = area;
 
-  int randX = rand() % (int)(area.x+0.5f);
-  int randY = rand() % (int)(area.y+0.5f);
+  int randX = GetField()->GetRandom().Next((int)(area.x+0.5f));
+  int randY = GetField()->GetRandom().Next((int)(area.y+0.5f));
 
   int randNegX = 1;
   int randNegY = 1;
 
-  if (rand() % 10 > 5) randNegX = -1;
-  if (rand() % 10 > 5) randNegY = -1;
+  if (GetField()->GetRandom().Next(10) > 5) randNegX = -1;
+  if (GetField()->GetRandom().Next(10) > 5) randNegY = -1;
 
   randX *= randNegX;
   randY *= -randY;
@@ -1,15 +1,21 @@
 #include "bnField.h"
+#include "bnProfiler.h"
 #include "bnObstacle.h"
 #include "bnCharacter.h"
 #include "bnSpell.h"
 #include "bnArtifact.h"
 #include "bnTextureResourceManager.h"
 
+#include <algorithm>
+
 constexpr auto TILE_ANIMATION_PATH = "resources/tiles/tiles.animation";
 
-Field::Field(int _width, int _height)
+Field::Field(int _width, int _height, uint64_t seed)
   : width(_width),
   height(_height),
+  random(seed),
+  queryDepth(0),
+  hasHoles(false),
   pending(),
   tiles(vector<vector<Battle::Tile*>>())
   {
@@ -185,23 +191,216 @@ void Field::AddEntity(Artifact & art, Battle::Tile & dest)
   AddEntity(art, dest.GetX(), dest.GetY());
 }
 
+template<typename T>
+void Field::SortByTile(vector<T*>& list) {
+  std::stable_sort(list.begin(), list.end(), [](T* a, T* b) {
+    Battle::Tile* tileA = a->GetTile();
+    Battle::Tile* tileB = b->GetTile();
+
+    if (!tileA || !tileB) return tileA != nullptr && tileB == nullptr;
+
+    if (tileA->GetY() != tileB->GetY()) return tileA->GetY() < tileB->GetY();
+
+    return tileA->GetX() < tileB->GetX();
+  });
+}
+
+template<typename T>
+void Field::EraseFromBucket(vector<T*>& bucket, T* ptr) {
+  auto found = std::find(bucket.begin(), bucket.end(), ptr);
+
+  if (found == bucket.end()) return;
+
+  if (queryDepth > 0) {
+    *found = nullptr;
+    hasHoles = true;
+  }
+  else {
+    bucket.erase(found);
+  }
+}
+
+void Field::EndQuery() {
+  if (--queryDepth > 0 || !hasHoles) return;
+
+  auto compact = [](auto& bucket) {
+    bucket.erase(std::remove(bucket.begin(), bucket.end(), nullptr), bucket.end());
+  };
+
+  compact(entityBucket);
+  compact(characterBucket);
+
+  for (auto& team : teamBuckets) {
+    compact(team.second);
+  }
+
+  hasHoles = false;
+}
+
 std::vector<Entity*> Field::FindEntities(std::function<bool(Entity* e)> query)
 {
   std::vector<Entity*> res;
 
-  for (int y = 1; y <= height; y++) {
-    for (int x = 1; x <= width; x++) {
-      Battle::Tile* tile = GetAt(x, y);
+  // Queries may add or remove entities. Added ones are not visited, removed ones leave a hole.
+  queryDepth++;
+
+  const size_t count = entityBucket.size();
+
+  for (size_t i = 0; i < count; i++) {
+    Entity* e = entityBucket[i];
+
+    if (e && query(e)) {
+      res.push_back(e);
+    }
+  }
+
+  EndQuery();
+  SortByTile(res);
+
+  return res;
+}
+
+std::vector<Entity*> Field::FindEntities(Team team, std::function<bool(Entity* e)> query)
+{
+  std::vector<Entity*> res;
+
+  auto iter = teamBuckets.find(team);
+
+  if (iter == teamBuckets.end()) return res;
 
-      std::vector<Entity*> found = tile->FindEntities(query);
-      res.reserve(res.size() + found.size()); // preallocate memory
-      res.insert(res.end(), found.begin(), found.end());
+  // Map nodes do not move, the bucket stays valid even if the query adds a team
+  auto& bucket = iter->second;
+
+  queryDepth++;
+
+  const size_t count = bucket.size();
+
+  for (size_t i = 0; i < count; i++) {
+    Entity* e = bucket[i];
+
+    if (e && query(e)) {
+      res.push_back(e);
     }
   }
 
+  EndQuery();
+  SortByTile(res);
+
   return res;
 }
 
+std::vector<Character*> Field::FindCharacters(std::function<bool(Character* e)> query)
+{
+  std::vector<Character*> res;
+
+  queryDepth++;
+
+  const size_t count = characterBucket.size();
+
+  for (size_t i = 0; i < count; i++) {
+    Character* c = characterBucket[i];
+
+    if (c && query(c)) {
+      res.push_back(c);
+    }
+  }
+
+  EndQuery();
+  SortByTile(res);
+
+  return res;
+}
+
+Entity* Field::GetEntityByID(long ID) const
+{
+  auto iter = entityIndex.find(ID);
+  return iter == entityIndex.end() ? nullptr : iter->second.entity;
+}
+
+Spell* Field::GetSpellByID(long ID) const
+{
+  auto iter = entityIndex.find(ID);
+  return iter == entityIndex.end() ? nullptr : iter->second.spell;
+}
+
+Character* Field::GetCharacterByID(long ID) const
+{
+  auto iter = entityIndex.find(ID);
+  return iter == entityIndex.end() ? nullptr : iter->second.character;
+}
+
+void Field::IndexEntity(Character & character)
+{
+  IndexEntity(indexEntry{ &character, &character, nullptr, nullptr, character.GetTeam(), 0 });
+}
+
+void Field::IndexEntity(Spell & spell)
+{
+  IndexEntity(indexEntry{ &spell, nullptr, &spell, nullptr, spell.GetTeam(), 0 });
+}
+
+void Field::IndexEntity(Artifact & artifact)
+{
+  IndexEntity(indexEntry{ &artifact, nullptr, nullptr, &artifact, artifact.GetTeam(), 0 });
+}
+
+void Field::IndexEntity(const indexEntry& entry)
+{
+  auto iter = entityIndex.find(entry.entity->GetID());
+
+  if (iter != entityIndex.end()) {
+    // already claimed by another tile
+    iter->second.refs++;
+    return;
+  }
+
+  auto& added = entityIndex[entry.entity->GetID()] = entry;
+  added.refs = 1;
+
+  entityBucket.push_back(entry.entity);
+  teamBuckets[entry.team].push_back(entry.entity);
+
+  for (auto component : entry.entity->components) {
+    componentRegistry.Add(component);
+  }
+
+  if (entry.character) {
+    characterBucket.push_back(entry.character);
+  }
+}
+
+void Field::UnindexEntity(long ID)
+{
+  auto iter = entityIndex.find(ID);
+
+  if (iter == entityIndex.end()) return;
+
+  if (--iter->second.refs > 0) return;
+
+  auto& entry = iter->second;
+
+  EraseFromBucket(entityBucket, entry.entity);
+  EraseFromBucket(teamBuckets[entry.team], entry.entity);
+
+  if (entry.character) {
+    EraseFromBucket(characterBucket, entry.character);
+  }
+
+  entityIndex.erase(iter);
+}
+
+void Field::ReindexEntityTeam(Entity & entity)
+{
+  auto iter = entityIndex.find(entity.GetID());
+
+  if (iter == entityIndex.end() || iter->second.team == entity.GetTeam()) return;
+
+  EraseFromBucket(teamBuckets[iter->second.team], &entity);
+
+  iter->second.team = entity.GetTeam();
+  teamBuckets[entity.GetTeam()].push_back(&entity);
+}
+
 void Field::SetAt(int _x, int _y, Team _team) {
   if (_x < 0 || _x > 7) return;
   if (_y < 0 || _y > 4) return;
@@ -216,7 +415,17 @@ Battle::Tile* Field::GetAt(int _x, int _y) const {
   return tiles[_y][_x];
 }
 
+Random& Field::GetRandom() {
+  return random;
+}
+
+ComponentRegistry& Field::GetComponentRegistry() {
+  return componentRegistry;
+}
+
 void Field::Update(float _elapsed) {
+  PROFILE_ZONE("Field::Update");
+
   while (pending.size()) {
     auto next = pending.back();
     pending.pop_back();
@@ -328,10 +537,26 @@ void Field::Update(float _elapsed) {
 
   backToRed.clear();
 
+  // Entities have moved and acted. Now their components, one type at a time.
+  componentRegistry.Update(_elapsed);
+
+  // Renderers draw between the last two ticks
+  for (auto entity : entityBucket) {
+    entity->RecordTickPosition();
+  }
+
   // UNLOCK ADD ENTITIES FUNCTION
   this->isUpdating = false;
 }
 
+void Field::HoldTickPositions() {
+  // Both recorded ticks become the current position so there is nothing to interpolate
+  for (auto entity : entityBucket) {
+    entity->RecordTickPosition();
+    entity->RecordTickPosition();
+  }
+}
+
 void Field::SetBattleActive(bool state)
 {
   isBattleActive = state;
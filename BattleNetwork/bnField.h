@@ -1,5 +1,7 @@
 #pragma once
 #include <vector>
+#include <map>
+#include <unordered_map>
 #include <iostream>
 
 using std::vector;
@@ -8,6 +10,8 @@ using std::endl;
 
 #include "bnEntity.h"
 #include "bnCharacterDeletePublisher.h"
+#include "bnRandom.h"
+#include "bnComponentRegistry.h"
 
 class Character;
 class Spell;
@@ -19,12 +23,16 @@ namespace Battle {
 }
 
 class Field : public CharacterDeletePublisher {
+  friend class Battle::Tile;
+  friend class Entity;
+
 public:
   
   /**
    * @brief Creates a field _wdith x _height tiles. Sets isBattleActive to false
+   * @param seed seeds the battle's random number generator
    */
-  Field(int _width, int _height);
+  Field(int _width, int _height, uint64_t seed = Random::MakeSeed());
   
   /**
    * @brief Deletes tiles
@@ -93,6 +101,44 @@ public:
    */
   std::vector<Entity*> FindEntities(std::function<bool(Entity* e)> query);
 
+  /**
+   * @brief Query for entities on one team
+   * @param team the team bucket to search
+   * @param query the query input function
+   * @return list of Entity* on `team` that passed the input function's conditions
+   */
+  std::vector<Entity*> FindEntities(Team team, std::function<bool(Entity* e)> query);
+
+  /**
+   * @brief Query for characters on the entire field
+   * 
+   * Mirrors the tile buckets: obstacles are grouped with spells and are not returned
+   * @param query the query input function
+   * @return list of Character* that passed the input function's conditions
+   */
+  std::vector<Character*> FindCharacters(std::function<bool(Character* e)> query);
+
+  /**
+   * @brief Lookup an entity occupying the field by ID
+   * @param ID
+   * @return null if no entity with ID is on the field, otherwise the entity
+   */
+  Entity* GetEntityByID(long ID) const;
+
+  /**
+   * @brief Lookup a spell (or obstacle) occupying the field by ID
+   * @param ID
+   * @return null if no spell with ID is on the field, otherwise the spell
+   */
+  Spell* GetSpellByID(long ID) const;
+
+  /**
+   * @brief Lookup a character occupying the field by ID
+   * @param ID
+   * @return null if no character with ID is on the field, otherwise the character
+   */
+  Character* GetCharacterByID(long ID) const;
+
   /**
    * @brief Set the tile at (x,y) team to _team
    * @param _x
@@ -114,6 +160,11 @@ public:
    * @param _elapsed in seconds
    */
   void Update(float _elapsed);
+
+  /**
+   * @brief Call for steps that skip Update(). Entities then draw where they are instead of between stale ticks.
+   */
+  void HoldTickPositions();
   
   /**
    * @brief Propagates the state to all tiles for specific behavior
@@ -128,12 +179,87 @@ public:
   */
   void TileRequestsRemovalOfQueued(Battle::Tile*, long ID);
 
+  /**
+   * @brief The battle's random number generator
+   * 
+   * Everything that affects the outcome of the battle must draw from here
+   * so the battle can be replayed from the field's seed
+   * @return Random&
+   */
+  Random& GetRandom();
+
+  /**
+   * @brief Components of every entity placed on the field, updated type by type in Update()
+   * @return ComponentRegistry&
+   */
+  ComponentRegistry& GetComponentRegistry();
+
 private:
+  /**
+   * @brief Tiles register entities as they are adopted so queries do not walk the grid
+   * 
+   * Only tiles inside the playable grid are indexed, mirroring the old FindEntities() scan.
+   * An entry is reference counted by the number of tiles that claim the entity.
+   */
+  void IndexEntity(Character& character);
+  void IndexEntity(Spell& spell);
+  void IndexEntity(Artifact& artifact);
+
+  /**
+   * @brief Tiles unregister entities when they are removed from their buckets
+   * @param ID
+   */
+  void UnindexEntity(long ID);
+
+  /**
+   * @brief Moves an indexed entity into its current team bucket
+   * @param entity
+   */
+  void ReindexEntityTeam(Entity& entity);
+
+  struct indexEntry {
+    Entity* entity;
+    Character* character; /*!< non-null if the entity is in the tile's character bucket */
+    Spell* spell; /*!< non-null if the entity is in the tile's spell bucket (includes obstacles) */
+    Artifact* artifact; /*!< non-null if the entity is in the tile's artifact bucket */
+    Team team; /*!< team bucket the entity is filed under */
+    int refs; /*!< number of tiles claiming this entity */
+  };
+
+  void IndexEntity(const indexEntry& entry);
+
+  /**
+   * @brief Removes ptr from bucket, or leaves a hole if a query is walking the buckets
+   */
+  template<typename T>
+  void EraseFromBucket(vector<T*>& bucket, T* ptr);
+
+  /**
+   * @brief Ends a query. The last query to end removes the holes left by removals.
+   */
+  void EndQuery();
+
+  /**
+   * @brief Puts query results in the old tile scan order: row by row, column by column
+   *
+   * Entities on the same tile keep the order they were added in
+   */
+  template<typename T>
+  static void SortByTile(vector<T*>& list);
+
+  std::unordered_map<long, indexEntry> entityIndex; /*!< ID -> entity lookup */
+  vector<Entity*> entityBucket; /*!< every indexed entity in the order they were added */
+  vector<Character*> characterBucket; /*!< indexed characters, excludes obstacles */
+  std::map<Team, vector<Entity*>> teamBuckets; /*!< indexed entities grouped by team */
 
   bool isBattleActive; /*!< State flag if battle is over */
   int width; /*!< col */
   int height; /*!< rows */
   bool isUpdating; /*!< enqueue entities if added in the update loop */
+  int queryDepth; /*!< queries running. Buckets are walked in place so removals wait. */
+  bool hasHoles; /*!< an entity was removed during a query */
+  Random random; /*!< battle PRNG */
+  ComponentRegistry componentRegistry; /*!< schedules the components of placed entities */
 
   struct queueBucket {
     int x;
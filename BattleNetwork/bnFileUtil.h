@@ -21,6 +21,7 @@
  * 
  * Has function that finds a key and attempts to parse the value wrapped in quotes.
  * Much can be improved here as this was originally legacy code.
+ * For reading whole files of key-value lines @see LineTokenizer
  */
 class FileUtil {
 public:
@@ -93,13 +94,12 @@ public:
 
     if (in.open(_path) && in.getSize() > 0) {
       sf::Int64 size = in.getSize();
-      char* buffer = new char[size + 1];
-      in.read(buffer, size);
-      buffer[size] = '\0';
 
-      std::string strbuff(buffer);
+      // Read straight into the string's storage
+      std::string strbuff((size_t)size, '\0');
+      sf::Int64 read = in.read(&strbuff[0], size);
 
-      delete[] buffer;
+      strbuff.resize(read > 0 ? (size_t)read : 0);
 
       return strbuff;
     }
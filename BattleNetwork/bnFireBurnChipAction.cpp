@@ -19,7 +19,8 @@ FireBurnChipAction::FireBurnChipAction(Character * owner, FireBurn::Type type, i
   this->damage = damage;
   this->type = type;
 
-  overlay.setTexture(*TextureResourceManager::GetInstance().LoadTextureFromFile(PATH));
+  overlayTexture = TextureResourceManager::GetInstance().LoadTextureFromFile(PATH);
+  overlay.setTexture(*overlayTexture);
   this->attachment = new SpriteSceneNode(overlay);
   this->attachment->SetLayer(-1);
   attachmentAnim.Reload();
@@ -47,7 +48,7 @@ void FireBurnChipAction::Execute() {
     fb->SetHitboxProperties(props);
 
     // update node position in the animation
-    auto baseOffset = anim->GetPoint(nodeName).y - anim->GetPoint("origin").y;
+    auto baseOffset = anim->GetPoint(nodePointID).y - anim->GetPoint(FramePoints::ORIGIN).y;
 
     if (baseOffset < 0) { baseOffset = -baseOffset; }
 
@@ -3,12 +3,14 @@
 #include "bnAnimation.h"
 #include "bnFireBurn.h"
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class SpriteSceneNode;
 class Character;
 class FireBurnChipAction : public ChipAction {
 private:
   sf::Sprite overlay;
+  std::shared_ptr<sf::Texture> overlayTexture;
   SpriteSceneNode* attachment;
   Animation attachmentAnim;
   FireBurn::Type type;
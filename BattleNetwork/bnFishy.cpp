@@ -10,7 +10,7 @@ Fishy::Fishy(Field* _field, Team _team, double speed) : Obstacle(field, team) {
   hit = false;
   
   auto texture = TEXTURES.LoadTextureFromFile("resources/spells/fishy_temp.png");
-  setTexture(*texture);
+  setTexture(texture);
   setScale(2.f, 2.f);
   // why do we need to do this??
   // The super constructor is failing to set this value
@@ -0,0 +1,51 @@
+#include "bnFixedStepScheduler.h"
+
+#include <cmath>
+
+FixedStepScheduler::FixedStepScheduler(double step, unsigned maxTicksPerFrame)
+  : step(step), accumulator(0), dropped(0), maxTicksPerFrame(maxTicksPerFrame), ticksThisFrame(0) {
+}
+
+void FixedStepScheduler::BeginFrame(double seconds) {
+  if (seconds > 0) {
+    accumulator += seconds;
+  }
+
+  ticksThisFrame = 0;
+}
+
+bool FixedStepScheduler::Tick() {
+  if (accumulator < step) {
+    return false;
+  }
+
+  if (ticksThisFrame == maxTicksPerFrame) {
+    // Keep the fraction so the alpha stays continuous, drop the whole ticks we cannot afford
+    double kept = std::fmod(accumulator, step);
+
+    dropped += accumulator - kept;
+    accumulator = kept;
+    return false;
+  }
+
+  accumulator -= step;
+  ticksThisFrame++;
+
+  return true;
+}
+
+const double FixedStepScheduler::GetStep() const {
+  return step;
+}
+
+const float FixedStepScheduler::GetAlpha() const {
+  return (float)(accumulator / step);
+}
+
+const unsigned FixedStepScheduler::GetTicksThisFrame() const {
+  return ticksThisFrame;
+}
+
+const double FixedStepScheduler::GetDroppedTime() const {
+  return dropped;
+}
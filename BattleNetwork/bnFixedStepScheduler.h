@@ -0,0 +1,67 @@
+/*! \file bnFixedStepScheduler.h */
+
+/*! \brief Decides how many fixed simulation ticks to run for each rendered frame
+ *
+ * Real frame time is added to an accumulator and whole ticks are drained from it,
+ * so game speed no longer depends on the display rate. A slow frame runs several
+ * ticks to catch up, a fast frame may run none. The leftover fraction of a tick is
+ * the interpolation alpha renderers use to draw between the last two ticks.
+ *
+ * Catching up is capped at a few ticks per frame. Time beyond the cap is dropped
+ * so a long stall (loading, window drag) cannot snowball into an ever longer frame.
+ *
+ * while (scheduler.Tick()) { update(scheduler.GetStep()); }
+ * draw(scheduler.GetAlpha());
+ */
+
+#pragma once
+
+class FixedStepScheduler {
+public:
+  /**
+   * @brief Ticks every step seconds
+   * @param step seconds per simulation tick
+   * @param maxTicksPerFrame catch up limit
+   */
+  FixedStepScheduler(double step, unsigned maxTicksPerFrame);
+
+  /**
+   * @brief Adds real time since the last frame
+   * @param seconds
+   */
+  void BeginFrame(double seconds);
+
+  /**
+   * @brief Consumes one tick from the accumulator
+   * @return false when no whole tick is left or the frame has run its limit
+   */
+  bool Tick();
+
+  /**
+   * @brief Seconds per tick
+   */
+  const double GetStep() const;
+
+  /**
+   * @brief Fraction of a tick left in the accumulator after ticking
+   * @return in [0, 1)
+   */
+  const float GetAlpha() const;
+
+  /**
+   * @brief Ticks run since BeginFrame()
+   */
+  const unsigned GetTicksThisFrame() const;
+
+  /**
+   * @brief Total seconds dropped because frames hit the catch up limit
+   */
+  const double GetDroppedTime() const;
+
+private:
+  double step; /*!< seconds per tick */
+  double accumulator; /*!< real time not yet simulated */
+  double dropped; /*!< time discarded by the catch up limit */
+  unsigned maxTicksPerFrame;
+  unsigned ticksThisFrame;
+};
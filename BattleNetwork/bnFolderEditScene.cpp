@@ -825,10 +825,6 @@ void FolderEditScene::DrawLibrary() {
 }
 
 void FolderEditScene::onEnd() {
-  delete font;
-  delete chipFont;
-  delete chipDescFont;
-  delete numberFont;
   delete menuLabel;
   delete numberLabel;
   delete chipDesc;
@@ -102,7 +102,7 @@ private:
   ChipFolder& folder;
 
   // Menu name font
-  sf::Font* font;
+  std::shared_ptr<sf::Font> font;
   sf::Text* menuLabel;
 
   // Selection input delays
@@ -110,14 +110,14 @@ private:
   double selectInputCooldown;
 
   // Chip UI font
-  sf::Font *chipFont;
+  std::shared_ptr<sf::Font> chipFont;
   sf::Text *chipLabel;
 
-  sf::Font *numberFont;
+  std::shared_ptr<sf::Font> numberFont;
   sf::Text *numberLabel;
 
   // Chip description font
-  sf::Font *chipDescFont;
+  std::shared_ptr<sf::Font> chipDescFont;
   sf::Text* chipDesc;
 
   // folder menu graphic
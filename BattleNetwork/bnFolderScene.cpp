@@ -624,9 +624,6 @@ void FolderScene::DeleteFolder(std::function<void()> onSuccess)
 }
 
 void FolderScene::onEnd() {
-  delete font;
-  delete chipFont;
-  delete numberFont;
   delete menuLabel;
   delete numberLabel;
 
@@ -116,7 +116,7 @@ const bool Gear::OnHit(const Hit::Properties props) {
 }
 
 void Gear::Attack(Character* other) {
-  Obstacle* isObstacle = dynamic_cast<Obstacle*>(other);
+  Obstacle* isObstacle = other->As<Obstacle>();
 
   if (isObstacle) {
     auto props = Hit::DefaultProperties;
@@ -20,14 +20,14 @@ GuardHit::GuardHit(Field* _field, Character* hit, bool center) : Artifact(_field
 
   if (!center) {
     float random = hit->getLocalBounds().width / 2.0f;
-    random *= rand() % 2 == 0 ? -1.0f : 1.0f;
+    random *= GetField()->GetRandom().Next(2) == 0 ? -1.0f : 1.0f;
 
     w = (float)random;
 
     h = (float)(std::floor(hit->GetHeight()));
 
     if (h > 0) {
-      h = (float)(rand() % (int)h);
+      h = (float)(GetField()->GetRandom().Next((int)h));
     }
   }
   else {
@@ -16,9 +16,9 @@ HoneyBomberMob::~HoneyBomberMob()
 Mob* HoneyBomberMob::Build() {
   Mob* mob = new Mob(field);
 
-  mob->Spawn<Rank1<HoneyBomber>>(4 + (rand() % 3), 1);
-  mob->Spawn<Rank1<HoneyBomber>>(4 + (rand() % 3), 2);
-  mob->Spawn<Rank1<HoneyBomber>>(4 + (rand() % 3), 3);
+  mob->Spawn<Rank1<HoneyBomber>>(4 + field->GetRandom().Next(3), 1);
+  mob->Spawn<Rank1<HoneyBomber>>(4 + field->GetRandom().Next(3), 2);
+  mob->Spawn<Rank1<HoneyBomber>>(4 + field->GetRandom().Next(3), 3);
 
   return mob;
 }
@@ -41,7 +41,7 @@ void HoneyBomberMoveState::OnUpdate(float _elapsed, HoneyBomber& honey) {
   int teley = 0;
 
   if (myteam.size() > 0) {
-      int randIndex = rand() % myteam.size();
+      int randIndex = honey.GetField()->GetRandom().Next((int)myteam.size());
       telex = myteam[randIndex]->GetX();
       teley = myteam[randIndex]->GetY();
   }
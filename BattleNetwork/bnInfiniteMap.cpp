@@ -14,7 +14,7 @@ namespace Overworld {
     // One long road
     int row = 0;
     for (int i = 0; i < numOfCols; i++) {
-      map.push_back(new Tile(sf::Vector2f((float)i*tileWidth, (float)row*tileHeight)));
+      map.push_back(new Tile(sf::Vector2f((float)i*tileWidth, (float)row*tileHeight), random));
     }
 
     // Add the arrow at the top
@@ -157,7 +157,7 @@ namespace Overworld {
 
     if (std::max((int)(map.size()-branchDepth), 0) < cols*5) {
 
-      Overworld::Tile* tile = new Tile(sf::Vector2f(head->GetPos().x + this->GetTileSize().x, head->GetPos().y));
+      Overworld::Tile* tile = new Tile(sf::Vector2f(head->GetPos().x + this->GetTileSize().x, head->GetPos().y), random);
       map.push_back(tile);
 
       head = tile;
@@ -172,8 +172,8 @@ namespace Overworld {
 	  int distFromPath = 0;
 
 	  while (depth < branchDepth) {
-	    int randDirection = rand() % 3;
-		  int randSpawnNPC = rand() % 70;
+	    int randDirection = random.Next(3);
+		  int randSpawnNPC = random.Next(70);
 
 	      if (randDirection == 0 && lastDirection == 1)
 	        continue;
@@ -187,11 +187,11 @@ namespace Overworld {
 		  if (randDirection == 0) {
 	      distFromPath--;
 
-			  offroad = new Tile(sf::Vector2f(offroad->GetPos().x, offroad->GetPos().y + this->GetTileSize().y));
+			  offroad = new Tile(sf::Vector2f(offroad->GetPos().x, offroad->GetPos().y + this->GetTileSize().y), random);
 			  map.push_back(offroad);
 				
 			  if (randSpawnNPC == 0 && distFromPath != 0) {
-          npcType = (NPCType)(rand()%((int)(NPCType::MR_PROG_FIRE) + 1));
+          npcType = (NPCType)(random.Next((int)(NPCType::MR_PROG_FIRE) + 1));
 			    npcs.push_back(new NPC { sf::Sprite(LOAD_TEXTURE(OW_MR_PROG)), npcType });
 
 			    sf::Vector2f pos = offroad->GetPos();
@@ -208,11 +208,11 @@ namespace Overworld {
 		  else if (randDirection == 1) {
 			  distFromPath++;
 
-			  offroad = new Tile(sf::Vector2f(offroad->GetPos().x, offroad->GetPos().y - this->GetTileSize().y));
+			  offroad = new Tile(sf::Vector2f(offroad->GetPos().x, offroad->GetPos().y - this->GetTileSize().y), random);
 			  map.push_back(offroad);
 
 			  if (randSpawnNPC == 0 && distFromPath != 0) {
-          npcType = (NPCType)(rand()%((int)(NPCType::MR_PROG_FIRE) + 1));
+          npcType = (NPCType)(random.Next((int)(NPCType::MR_PROG_FIRE) + 1));
 		        npcs.push_back(new NPC { sf::Sprite(LOAD_TEXTURE(OW_MR_PROG)), npcType });
 
 			    sf::Vector2f pos = offroad->GetPos();
@@ -227,23 +227,23 @@ namespace Overworld {
 			  depth++;
 		  }
 		  else if (depth > 1) {
-			  offroad = new Tile(sf::Vector2f(offroad->GetPos().x + this->GetTileSize().x, offroad->GetPos().y));
+			  offroad = new Tile(sf::Vector2f(offroad->GetPos().x + this->GetTileSize().x, offroad->GetPos().y), random);
 			  map.push_back(offroad);
 
 			  depth++;
 		  }
 
-		  /*int randLight = rand() % 100;
+		  /*int randLight = random.Next(100);
 
 		  sf::Vector2f pos = offroad->GetPos();
 		  pos += sf::Vector2f(45, 0);
 
 		  if (randLight < 10) {
 			sf::Uint8 lighten = 180;
-			sf::Uint8 r = rand() % (256 - lighten);
-			sf::Uint8 g = rand() % (256 - lighten);
-			sf::Uint8 b = rand() % (256 - lighten);
-			double radius = (double)(rand() % 120);
+			sf::Uint8 r = random.Next(256 - lighten);
+			sf::Uint8 g = random.Next(256 - lighten);
+			sf::Uint8 b = random.Next(256 - lighten);
+			double radius = (double)(random.Next(120));
 
 			if(randLight < 3)
 			  this->AddLight(new Light(pos, sf::Color(r + lighten, 0, r + lighten, 255), radius));
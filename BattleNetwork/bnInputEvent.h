@@ -1,7 +1,39 @@
 /*! \brief All of the virtual input events to map to joysticks and keyboard commands */
 
 #pragma once
+#include <bitset>
+#include <cstddef>
 #include <string>
+
+/*! \brief Every game action a key or button can be bound to
+ *
+ * The order matches EventTypes::KEYS, the names written to the config file
+ */
+enum class InputAction : unsigned char {
+  MOVE_UP = 0,
+  MOVE_DOWN,
+  MOVE_LEFT,
+  MOVE_RIGHT,
+  SHOOT,
+  USE_CHIP,
+  SPECIAL,
+  CUST_MENU,
+  PAUSE,
+  UI_UP,
+  UI_LEFT,
+  UI_RIGHT,
+  UI_DOWN,
+  CONFIRM,
+  CANCEL,
+  QUICK_OPT,
+  SCAN_LEFT,
+  SCAN_RIGHT,
+  SIZE
+};
+
+/*! \brief One bit per InputAction */
+typedef std::bitset<(size_t)InputAction::SIZE> InputActions;
+
 enum InputState {
   PRESSED,
   HELD,
@@ -10,86 +42,79 @@ enum InputState {
 };
 
 struct InputEvent {
-  std::string name;
+  InputAction action;
   InputState state;
 
-  const bool operator==(InputEvent& rhs) {
-    return (rhs.name == this->name && rhs.state == this->state);
+  constexpr bool operator==(const InputEvent& rhs) const {
+    return (rhs.action == this->action && rhs.state == this->state);
   }
 
-  const bool operator!=(InputEvent& rhs) {
+  constexpr bool operator!=(const InputEvent& rhs) const {
     return !(rhs == *this);
   }
-
-  const bool operator==(const InputEvent& rhs) {
-    return (rhs.name == this->name && rhs.state == this->state);
-  }
-
-  const bool operator!=(const InputEvent& rhs) {
-    return !(rhs.name == this->name && rhs.state == this->state);
-  }
 };
 
 namespace EventTypes {
-  static const InputEvent NONE = { "", InputState::NONE };
+  static constexpr InputEvent NONE = { InputAction::SIZE, InputState::NONE };
 
-  static const InputEvent PRESSED_MOVE_UP    = { "Move Up",    PRESSED };
-  static const InputEvent PRESSED_MOVE_DOWN  = { "Move Down",  PRESSED };
-  static const InputEvent PRESSED_MOVE_LEFT  = { "Move Left",  PRESSED };
-  static const InputEvent PRESSED_MOVE_RIGHT = { "Move Right", PRESSED };
-  static const InputEvent PRESSED_SHOOT      = { "Shoot",      PRESSED };
-  static const InputEvent PRESSED_USE_CHIP   = { "Use Chip",   PRESSED };
-  static const InputEvent PRESSED_SPECIAL    = { "Special",    PRESSED };
-  static const InputEvent PRESSED_CUST_MENU  = { "Cust Menu",  PRESSED };
-  static const InputEvent PRESSED_PAUSE      = { "Pause",      PRESSED };
-  static const InputEvent PRESSED_UI_UP      = { "UI Up",      PRESSED };
-  static const InputEvent PRESSED_UI_DOWN    = { "UI Down",    PRESSED };
-  static const InputEvent PRESSED_UI_LEFT    = { "UI Left",    PRESSED };
-  static const InputEvent PRESSED_UI_RIGHT   = { "UI Right",   PRESSED };
-  static const InputEvent PRESSED_CONFIRM    = { "Confirm",    PRESSED };
-  static const InputEvent PRESSED_CANCEL     = { "Cancel",     PRESSED };
-  static const InputEvent PRESSED_QUICK_OPT  = { "Quick Opt",  PRESSED };
-  static const InputEvent PRESSED_SCAN_LEFT  = { "Scan Left",  PRESSED };
-  static const InputEvent PRESSED_SCAN_RIGHT = { "Scan Right", PRESSED };
+  static constexpr InputEvent PRESSED_MOVE_UP    = { InputAction::MOVE_UP,    PRESSED };
+  static constexpr InputEvent PRESSED_MOVE_DOWN  = { InputAction::MOVE_DOWN,  PRESSED };
+  static constexpr InputEvent PRESSED_MOVE_LEFT  = { InputAction::MOVE_LEFT,  PRESSED };
+  static constexpr InputEvent PRESSED_MOVE_RIGHT = { InputAction::MOVE_RIGHT, PRESSED };
+  static constexpr InputEvent PRESSED_SHOOT      = { InputAction::SHOOT,      PRESSED };
+  static constexpr InputEvent PRESSED_USE_CHIP   = { InputAction::USE_CHIP,   PRESSED };
+  static constexpr InputEvent PRESSED_SPECIAL    = { InputAction::SPECIAL,    PRESSED };
+  static constexpr InputEvent PRESSED_CUST_MENU  = { InputAction::CUST_MENU,  PRESSED };
+  static constexpr InputEvent PRESSED_PAUSE      = { InputAction::PAUSE,      PRESSED };
+  static constexpr InputEvent PRESSED_UI_UP      = { InputAction::UI_UP,      PRESSED };
+  static constexpr InputEvent PRESSED_UI_DOWN    = { InputAction::UI_DOWN,    PRESSED };
+  static constexpr InputEvent PRESSED_UI_LEFT    = { InputAction::UI_LEFT,    PRESSED };
+  static constexpr InputEvent PRESSED_UI_RIGHT   = { InputAction::UI_RIGHT,   PRESSED };
+  static constexpr InputEvent PRESSED_CONFIRM    = { InputAction::CONFIRM,    PRESSED };
+  static constexpr InputEvent PRESSED_CANCEL     = { InputAction::CANCEL,     PRESSED };
+  static constexpr InputEvent PRESSED_QUICK_OPT  = { InputAction::QUICK_OPT,  PRESSED };
+  static constexpr InputEvent PRESSED_SCAN_LEFT  = { InputAction::SCAN_LEFT,  PRESSED };
+  static constexpr InputEvent PRESSED_SCAN_RIGHT = { InputAction::SCAN_RIGHT, PRESSED };
 
-  static const InputEvent RELEASED_MOVE_UP    = { "Move Up",    RELEASED };
-  static const InputEvent RELEASED_MOVE_DOWN  = { "Move Down",  RELEASED };
-  static const InputEvent RELEASED_MOVE_LEFT  = { "Move Left",  RELEASED };
-  static const InputEvent RELEASED_MOVE_RIGHT = { "Move Right", RELEASED };
-  static const InputEvent RELEASED_SHOOT      = { "Shoot",      RELEASED };
-  static const InputEvent RELEASED_USE_CHIP   = { "Use Chip",   RELEASED };
-  static const InputEvent RELEASED_SPECIAL    = { "Special",    RELEASED };
-  static const InputEvent RELEASED_CUST_MENU  = { "Cust Menu",  RELEASED };
-  static const InputEvent RELEASED_PAUSE      = { "Pause",      RELEASED };
-  static const InputEvent RELEASED_UI_UP      = { "UI Up",      RELEASED };
-  static const InputEvent RELEASED_UI_DOWN    = { "UI Down",    RELEASED };
-  static const InputEvent RELEASED_UI_LEFT    = { "UI Left",    RELEASED };
-  static const InputEvent RELEASED_UI_RIGHT   = { "UI Right",   RELEASED };
-  static const InputEvent RELEASED_CONFIRM    = { "Confirm",    RELEASED };
-  static const InputEvent RELEASED_CANCEL     = { "Cancel",     RELEASED };
-  static const InputEvent RELEASED_QUICK_OPT  = { "Quick Opt",  RELEASED };
-  static const InputEvent RELEASED_SCAN_LEFT  = { "Scan Left",  RELEASED };
-  static const InputEvent RELEASED_SCAN_RIGHT = { "Scan Right", RELEASED };
+  static constexpr InputEvent RELEASED_MOVE_UP    = { InputAction::MOVE_UP,    RELEASED };
+  static constexpr InputEvent RELEASED_MOVE_DOWN  = { InputAction::MOVE_DOWN,  RELEASED };
+  static constexpr InputEvent RELEASED_MOVE_LEFT  = { InputAction::MOVE_LEFT,  RELEASED };
+  static constexpr InputEvent RELEASED_MOVE_RIGHT = { InputAction::MOVE_RIGHT, RELEASED };
+  static constexpr InputEvent RELEASED_SHOOT      = { InputAction::SHOOT,      RELEASED };
+  static constexpr InputEvent RELEASED_USE_CHIP   = { InputAction::USE_CHIP,   RELEASED };
+  static constexpr InputEvent RELEASED_SPECIAL    = { InputAction::SPECIAL,    RELEASED };
+  static constexpr InputEvent RELEASED_CUST_MENU  = { InputAction::CUST_MENU,  RELEASED };
+  static constexpr InputEvent RELEASED_PAUSE      = { InputAction::PAUSE,      RELEASED };
+  static constexpr InputEvent RELEASED_UI_UP      = { InputAction::UI_UP,      RELEASED };
+  static constexpr InputEvent RELEASED_UI_DOWN    = { InputAction::UI_DOWN,    RELEASED };
+  static constexpr InputEvent RELEASED_UI_LEFT    = { InputAction::UI_LEFT,    RELEASED };
+  static constexpr InputEvent RELEASED_UI_RIGHT   = { InputAction::UI_RIGHT,   RELEASED };
+  static constexpr InputEvent RELEASED_CONFIRM    = { InputAction::CONFIRM,    RELEASED };
+  static constexpr InputEvent RELEASED_CANCEL     = { InputAction::CANCEL,     RELEASED };
+  static constexpr InputEvent RELEASED_QUICK_OPT  = { InputAction::QUICK_OPT,  RELEASED };
+  static constexpr InputEvent RELEASED_SCAN_LEFT  = { InputAction::SCAN_LEFT,  RELEASED };
+  static constexpr InputEvent RELEASED_SCAN_RIGHT = { InputAction::SCAN_RIGHT, RELEASED };
 
-  static const InputEvent HELD_MOVE_UP        = { "Move Up",    HELD };
-  static const InputEvent HELD_MOVE_DOWN      = { "Move Down",  HELD };
-  static const InputEvent HELD_MOVE_LEFT      = { "Move Left",  HELD };
-  static const InputEvent HELD_MOVE_RIGHT     = { "Move Right", HELD };
-  static const InputEvent HELD_SHOOT          = { "Shoot",      HELD };
-  static const InputEvent HELD_USE_CHIP       = { "Use Chip",   HELD };
-  static const InputEvent HELD_SPECIAL        = { "Special",    HELD };
-  static const InputEvent HELD_CUST_MENU      = { "Cust Menu",  HELD };
-  static const InputEvent HELD_PAUSE          = { "Pause",      HELD };
-  static const InputEvent HELD_UI_UP          = { "UI Up",      HELD };
-  static const InputEvent HELD_UI_DOWN        = { "UI Down",    HELD };
-  static const InputEvent HELD_UI_LEFT        = { "UI Left",    HELD };
-  static const InputEvent HELD_UI_RIGHT       = { "UI Right",   HELD };
-  static const InputEvent HELD_CONFIRM        = { "Confirm",    HELD };
-  static const InputEvent HELD_CANCEL         = { "Cancel",     HELD };
-  static const InputEvent HELD_QUICK_OPT      = { "Quick Opt",  HELD };
-  static const InputEvent HELD_SCAN_LEFT      = { "Scan Left",  HELD };
-  static const InputEvent HELD_SCAN_RIGHT     = { "Scan Right", HELD };
+  static constexpr InputEvent HELD_MOVE_UP        = { InputAction::MOVE_UP,    HELD };
+  static constexpr InputEvent HELD_MOVE_DOWN      = { InputAction::MOVE_DOWN,  HELD };
+  static constexpr InputEvent HELD_MOVE_LEFT      = { InputAction::MOVE_LEFT,  HELD };
+  static constexpr InputEvent HELD_MOVE_RIGHT     = { InputAction::MOVE_RIGHT, HELD };
+  static constexpr InputEvent HELD_SHOOT          = { InputAction::SHOOT,      HELD };
+  static constexpr InputEvent HELD_USE_CHIP       = { InputAction::USE_CHIP,   HELD };
+  static constexpr InputEvent HELD_SPECIAL        = { InputAction::SPECIAL,    HELD };
+  static constexpr InputEvent HELD_CUST_MENU      = { InputAction::CUST_MENU,  HELD };
+  static constexpr InputEvent HELD_PAUSE          = { InputAction::PAUSE,      HELD };
+  static constexpr InputEvent HELD_UI_UP          = { InputAction::UI_UP,      HELD };
+  static constexpr InputEvent HELD_UI_DOWN        = { InputAction::UI_DOWN,    HELD };
+  static constexpr InputEvent HELD_UI_LEFT        = { InputAction::UI_LEFT,    HELD };
+  static constexpr InputEvent HELD_UI_RIGHT       = { InputAction::UI_RIGHT,   HELD };
+  static constexpr InputEvent HELD_CONFIRM        = { InputAction::CONFIRM,    HELD };
+  static constexpr InputEvent HELD_CANCEL         = { InputAction::CANCEL,     HELD };
+  static constexpr InputEvent HELD_QUICK_OPT      = { InputAction::QUICK_OPT,  HELD };
+  static constexpr InputEvent HELD_SCAN_LEFT      = { InputAction::SCAN_LEFT,  HELD };
+  static constexpr InputEvent HELD_SCAN_RIGHT     = { InputAction::SCAN_RIGHT, HELD };
 
+  /*! \brief Action names used by the config file. Indexed by InputAction. */
   static const std::string KEYS[] = { "Move Up", "Move Down", "Move Left", "Move Right", "Shoot",
                                     "Use Chip", "Special", "Cust Menu", "Pause", "UI Up", "UI Left", "UI Right", 
                                     "UI Down", "Confirm", "Cancel", "Quick Opt", "Scan Left", "Scan Right" };
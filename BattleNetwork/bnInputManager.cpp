@@ -3,6 +3,7 @@ using sf::Event;
 using sf::Keyboard;
 #include "bnEngine.h"
 #include "bnInputManager.h"
+#include "bnProfiler.h"
 
 #if defined(__ANDROID__)
 #include "Android/bnTouchArea.h"
@@ -22,6 +23,12 @@ InputManager::InputManager()  : settings() {
   lastkey = sf::Keyboard::Key::Unknown;
   lastButton = (decltype(lastButton))-1;
   lastAxisXPower = axisXPower = lastAxisYPower = axisYPower = 0.f;
+  recording = nullptr;
+  replay = nullptr;
+  frame = 0;
+  replayEntry = 0;
+
+  BuildLookupTables();
 }
 
 
@@ -30,13 +37,74 @@ InputManager::~InputManager() {
 
 void InputManager::SupportConfigSettings(ConfigReader& reader) {
   settings = reader.GetConfigSettings();
-  events.clear();
-  eventsLastFrame.clear();
+  pressed.reset();
+  held.reset();
+  released.reset();
+
+  BuildLookupTables();
+}
+
+void InputManager::BuildLookupTables() {
+  for (auto& a : keyboardActions) a.reset();
+  for (auto& a : buttonActions) a.reset();
+  for (auto& a : axisActions) a.reset();
+
+  if (settings.IsOK()) {
+    for (int i = 0; i < sf::Keyboard::KeyCount; i++) {
+      keyboardActions[i] = settings.GetPairedActions((sf::Keyboard::Key)i);
+    }
+
+    for (int i = 0; i < (int)sf::Joystick::ButtonCount; i++) {
+      buttonActions[i] = settings.GetPairedActions((Gamepad)i);
+    }
+
+    for (int i = 0; i < 4; i++) {
+      axisActions[i] = settings.GetPairedActions((Gamepad)(Gamepad::UP + i));
+    }
+
+    return;
+  }
+
+  // No config file. Use the default keys.
+  auto bind = [this](sf::Keyboard::Key key, InputAction action) {
+    keyboardActions[key].set((size_t)action);
+  };
+
+  bind(Keyboard::Up, InputAction::MOVE_UP);         bind(Keyboard::Up, InputAction::UI_UP);
+  bind(Keyboard::Left, InputAction::MOVE_LEFT);     bind(Keyboard::Left, InputAction::UI_LEFT);
+  bind(Keyboard::Down, InputAction::MOVE_DOWN);     bind(Keyboard::Down, InputAction::UI_DOWN);
+  bind(Keyboard::Right, InputAction::MOVE_RIGHT);   bind(Keyboard::Right, InputAction::UI_RIGHT);
+  bind(Keyboard::X, InputAction::CONFIRM);          bind(Keyboard::X, InputAction::USE_CHIP);
+  bind(Keyboard::Z, InputAction::CANCEL);           bind(Keyboard::Z, InputAction::SHOOT);
+  bind(Keyboard::Space, InputAction::CUST_MENU);    bind(Keyboard::Space, InputAction::QUICK_OPT);
+  bind(Keyboard::P, InputAction::PAUSE);
+  bind(Keyboard::A, InputAction::CUST_MENU);
+  bind(Keyboard::S, InputAction::SPECIAL);
+  bind(Keyboard::D, InputAction::SCAN_LEFT);
+  bind(Keyboard::F, InputAction::SCAN_RIGHT);
+}
+
+const InputActions& InputManager::GetPairedActions(Gamepad button) const {
+  static const InputActions none;
+
+  if (button >= Gamepad::UP && button <= Gamepad::DOWN) {
+    return axisActions[button - Gamepad::UP];
+  }
+
+  if (button >= 0 && button < (int)sf::Joystick::ButtonCount) {
+    return buttonActions[button];
+  }
+
+  return none;
 }
 
 void InputManager::Update() {
-  this->eventsLastFrame = this->events;
-  this->events.clear();
+  PROFILE_ZONE("InputManager::Update");
+
+  const InputActions lastDown = pressed | held;
+
+  // Raw device signals for this frame. Resolved into pressed, held and released below.
+  InputActions nowPressed, nowReleased;
 
   Event event;
 
@@ -75,147 +143,28 @@ void InputManager::Update() {
 
     if (sf::Joystick::isConnected(GAMEPAD_1) && settings.IsOK()) {
       for (unsigned int i = 0; i < sf::Joystick::getButtonCount(GAMEPAD_1); i++) {
-        if (sf::Joystick::isButtonPressed(GAMEPAD_1, i)) {
-          auto action = settings.GetPairedActions((Gamepad)i);
+        const InputActions& action = GetPairedActions((Gamepad)i);
 
-          for (auto a : action) {
-            events.push_back({ a, InputState::PRESSED });
-          }
-          
+        if (sf::Joystick::isButtonPressed(GAMEPAD_1, i)) {
+          nowPressed |= action;
         } else {
           /*
           joysticks can only determine if the signal is on or off,
           we must compare with the last frame to determine if this 
           was a release event
           */
-          auto action = settings.GetPairedActions((Gamepad)i);
-
-          for (auto a : action) {
-            bool canRelease = false;
-
-            InputEvent find1 = { a, InputState::HELD };
-            InputEvent find2 = { a, InputState::PRESSED };
-
-            if (find(eventsLastFrame.begin(), eventsLastFrame.end(), find1) != eventsLastFrame.end()) {
-              canRelease = true;
-            }
-            else if (find(eventsLastFrame.begin(), eventsLastFrame.end(), find2) != eventsLastFrame.end()) {
-              canRelease = true;
-            }       
-
-            if (canRelease) {
-              events.push_back({ a, InputState::RELEASED });
-            }
-          }
+          nowReleased |= action & lastDown;
         }
       }
-    } else if (Event::KeyPressed == event.type) {
+    } else if (Event::KeyPressed == event.type || Event::KeyReleased == event.type) {
       /* Gamepad not connected. Strictly use keyboard events. */
-      if (settings.IsOK()) {
-        auto action = settings.GetPairedActions(event.key.code);
+      if (event.key.code < 0 || event.key.code >= sf::Keyboard::KeyCount) continue;
 
-        for (auto a : action) {
-          events.push_back({ a, InputState::PRESSED });
-        }
-      } else {
-        if (Keyboard::Up == event.key.code) {
-          events.push_back(EventTypes::PRESSED_MOVE_UP);
-          events.push_back(EventTypes::PRESSED_UI_UP);
-        }
-        else if (Keyboard::Left == event.key.code) {
-          events.push_back(EventTypes::PRESSED_MOVE_LEFT);
-          events.push_back(EventTypes::PRESSED_UI_LEFT);
-        }
-        else if (Keyboard::Down == event.key.code) {
-          events.push_back(EventTypes::PRESSED_MOVE_DOWN);
-          events.push_back(EventTypes::PRESSED_UI_DOWN);
-        }
-        else if (Keyboard::Right == event.key.code) {
-          events.push_back(EventTypes::PRESSED_MOVE_RIGHT);
-          events.push_back(EventTypes::PRESSED_UI_RIGHT);
-        }
-        else if (Keyboard::X == event.key.code) {
-          events.push_back(EventTypes::PRESSED_CONFIRM);
-          events.push_back(EventTypes::PRESSED_USE_CHIP);
-        }
-        else if (Keyboard::Z == event.key.code) {
-          events.push_back(EventTypes::PRESSED_CANCEL);
-          events.push_back(EventTypes::PRESSED_SHOOT);
-        }
-        else if (Keyboard::Space == event.key.code) {
-          events.push_back(EventTypes::PRESSED_CUST_MENU);
-          events.push_back(EventTypes::PRESSED_QUICK_OPT);
-        }
-        else if (Keyboard::P == event.key.code) {
-          events.push_back(EventTypes::PRESSED_PAUSE);
-        }
-        else if (Keyboard::A == event.key.code) {
-          events.push_back(EventTypes::PRESSED_CUST_MENU);
-        }
-        else if (Keyboard::S == event.key.code) {
-          events.push_back(EventTypes::PRESSED_SPECIAL);
-        }
-        else if (Keyboard::D == event.key.code) {
-          events.push_back(EventTypes::PRESSED_SCAN_LEFT);
-        }
-        else if (Keyboard::F == event.key.code) {
-          events.push_back(EventTypes::PRESSED_SCAN_RIGHT);
-        }
-      }
-    } else if (Event::KeyReleased == event.type) {
-      if (settings.IsOK()) {
-        auto action = settings.GetPairedActions(event.key.code);
-
-        if (!action.size()) continue;
-
-        for (auto a : action) {
-          events.push_back({ a, InputState::RELEASED });
-        }
+      if (Event::KeyPressed == event.type) {
+        nowPressed |= keyboardActions[event.key.code];
       }
       else {
-        if (Keyboard::Up == event.key.code) {
-          events.push_back(EventTypes::RELEASED_MOVE_UP);
-          events.push_back(EventTypes::RELEASED_UI_UP);
-        }
-        else if (Keyboard::Left == event.key.code) {
-          events.push_back(EventTypes::RELEASED_MOVE_LEFT);
-          events.push_back(EventTypes::RELEASED_UI_LEFT);
-        }
-        else if (Keyboard::Down == event.key.code) {
-          events.push_back(EventTypes::RELEASED_MOVE_DOWN);
-          events.push_back(EventTypes::RELEASED_UI_DOWN);
-        }
-        else if (Keyboard::Right == event.key.code) {
-          events.push_back(EventTypes::RELEASED_MOVE_RIGHT);
-          events.push_back(EventTypes::RELEASED_UI_RIGHT);
-        }
-        else if (Keyboard::X == event.key.code) {
-          events.push_back(EventTypes::RELEASED_CONFIRM);
-          events.push_back(EventTypes::RELEASED_USE_CHIP);
-        }
-        else if (Keyboard::Z == event.key.code) {
-          events.push_back(EventTypes::RELEASED_CANCEL);
-          events.push_back(EventTypes::RELEASED_SHOOT);
-        }
-        else if (Keyboard::Space == event.key.code) {
-          events.push_back(EventTypes::RELEASED_CUST_MENU);
-          events.push_back(EventTypes::RELEASED_QUICK_OPT);
-        }
-        else if (Keyboard::P == event.key.code) {
-          events.push_back(EventTypes::RELEASED_PAUSE);
-        }
-        else if (Keyboard::A == event.key.code) {
-          events.push_back(EventTypes::RELEASED_CUST_MENU);
-        }
-        else if (Keyboard::S == event.key.code) {
-          events.push_back(EventTypes::RELEASED_SPECIAL);
-        }
-        else if (Keyboard::D == event.key.code) {
-          events.push_back(EventTypes::RELEASED_SCAN_LEFT);
-        }
-        else if (Keyboard::F == event.key.code) {
-          events.push_back(EventTypes::RELEASED_SCAN_RIGHT);
-        }
+        nowReleased |= keyboardActions[event.key.code];
       }
     }
   } // end event poll
@@ -239,152 +188,115 @@ void InputManager::Update() {
 
     if (axisXPower <= -GAMEPAD_1_AXIS_SENSITIVITY) {
       lastButton = Gamepad::LEFT;
-
-      auto action = settings.GetPairedActions((Gamepad)lastButton);
-
-      for (auto a : action) {
-        events.push_back({ a, InputState::PRESSED });
-      }
+      nowPressed |= GetPairedActions(Gamepad::LEFT);
     }
     
     if (axisXPower >= GAMEPAD_1_AXIS_SENSITIVITY) {
       lastButton = Gamepad::RIGHT;
-
-      auto action = settings.GetPairedActions((Gamepad)lastButton);
-
-      for (auto a : action) {
-        events.push_back({ a, InputState::PRESSED });
-      }
+      nowPressed |= GetPairedActions(Gamepad::RIGHT);
     }
 
     if (axisYPower >= GAMEPAD_1_AXIS_SENSITIVITY) {
       lastButton = Gamepad::UP;
-
-      auto action = settings.GetPairedActions((Gamepad)lastButton);
-
-      for (auto a : action) {
-        events.push_back({ a, InputState::PRESSED });
-      }
+      nowPressed |= GetPairedActions(Gamepad::UP);
     }
 
     if (axisYPower <= -GAMEPAD_1_AXIS_SENSITIVITY) {
       lastButton = Gamepad::DOWN;
-
-      auto action = settings.GetPairedActions((Gamepad)lastButton);
-
-      for (auto a : action) {
-        events.push_back({ a, InputState::PRESSED });
-      }
+      nowPressed |= GetPairedActions(Gamepad::DOWN);
     }
 
     if (axisXPower - lastAxisXPower != 0.f) {
       if (axisXPower - lastAxisXPower >= -GAMEPAD_1_AXIS_SENSITIVITY) {
-        auto action = settings.GetPairedActions(Gamepad::LEFT);
-
-        for (auto a : action) {
-          events.push_back({ a, InputState::RELEASED });
-        }
+        nowReleased |= GetPairedActions(Gamepad::LEFT);
       }
 
       if (axisXPower - lastAxisXPower <= GAMEPAD_1_AXIS_SENSITIVITY) {
-        auto action = settings.GetPairedActions(Gamepad::RIGHT);
-
-        for (auto a : action) {
-          events.push_back({ a, InputState::RELEASED });
-        }
+        nowReleased |= GetPairedActions(Gamepad::RIGHT);
       }
     }
 
     if (axisYPower - lastAxisYPower != 0.f) {
       if (axisYPower - lastAxisYPower >= -GAMEPAD_1_AXIS_SENSITIVITY) {
-        auto action = settings.GetPairedActions(Gamepad::DOWN);
-
-        for (auto a : action) {
-          events.push_back({ a, InputState::RELEASED });
-        }
+        nowReleased |= GetPairedActions(Gamepad::DOWN);
       }
 
       if (axisYPower - lastAxisYPower <= GAMEPAD_1_AXIS_SENSITIVITY) {
-        auto action = settings.GetPairedActions(Gamepad::UP);
-
-        for (auto a : action) {
-          events.push_back({ a, InputState::RELEASED });
-        }
+        nowReleased |= GetPairedActions(Gamepad::UP);
       }
     }
   }
 
-  // First, we must see if any held keys from the last frame are released this frame
-  for (auto e : events) {
-    if (e.state == InputState::RELEASED) {
-      InputEvent find1 = { e.name, InputState::PRESSED };
-      InputEvent find2 = { e.name, InputState::HELD };
-      auto trunc = std::remove(eventsLastFrame.begin(), eventsLastFrame.end(), find1);
-      eventsLastFrame.erase(trunc, eventsLastFrame.end());
-
-      trunc = std::remove(eventsLastFrame.begin(), eventsLastFrame.end(), find2);
-      eventsLastFrame.erase(trunc, eventsLastFrame.end());
+  // A release this frame cancels both the press and the hold.
+  // Anything down last frame that was not released is held, and a held key cannot be pressed again.
+  released = nowReleased;
+  held = lastDown & ~nowReleased;
+  pressed = nowPressed & ~nowReleased & ~held;
 
-      trunc = std::remove(events.begin(), events.end(), find1);
-      events.erase(trunc, events.end());
+  /*
+  // Uncomment for debugging
+  for (size_t i = 0; i < (size_t)InputAction::SIZE; i++) {
+    const char* state = pressed[i] ? "PRESSED" : held[i] ? "HELD" : released[i] ? "RELEASED" : nullptr;
 
-      trunc = std::remove(events.begin(), events.end(), find2);
-      events.erase(trunc, events.end());
+    if (state) {
+      Logger::Logf("input event %s, %s", EventTypes::KEYS[i].c_str(), state);
     }
   }
+  */
 
-  // Finally, merge the continuous held key events into the final event buffer
-  for (auto e : eventsLastFrame) {
-    InputEvent insert = EventTypes::NONE;
-    InputEvent erase  = EventTypes::NONE;
+#ifdef __ANDROID__
+    pressed.reset(); // TODO: what inputs get stuck in the event list on droid?
+    held.reset();
+    released.reset();
+    TouchArea::poll();
+#endif
 
-      // Search for the held events to migrate into the current event frame
-      // Prevent further events if a key is held
-    if (e.state == HELD) {
-      insert = e;
-      erase = { e.name, PRESSED };
-    }
-   
-    // Search for press keys that have been held and transform them
-    if (e.state == PRESSED) {
-      insert = { e.name, HELD };
-      erase = e;
-    }
-   
-    auto trunc = std::remove(events.begin(), events.end(), erase);
-    events.erase(trunc, events.end());
+  if (replay) {
+    // Device input was only polled to keep the window alive. Feed the recording instead.
+    lastkey = sf::Keyboard::Key::Unknown;
+    lastButton = (decltype(lastButton))-1;
 
-    if (insert != EventTypes::NONE && std::find(events.begin(), events.end(), insert) == events.end()) {
-      events.push_back(insert); // migrate this input
-    }
+    replay->Replay(frame, replayEntry, pressed, held, released);
+    frame++;
   }
-  
-  /*
-  // Uncomment for debugging
-  for (auto e : events) {
-    std::string state = "NONE";
-
-    switch (e.state) {
-    case InputState::HELD:
-      state = "HELD";
-      break;
-    case InputState::RELEASED:
-      state = "RELEASED";
-      break;
-    case InputState::PRESSED:
-      state = "PRESSED";
-      break;
-    }
-    Logger::Logf("input event %s, %s", e.name.c_str(), state.c_str());
+  else if (recording) {
+    recording->Push(frame, InputRecording::Encode(pressed, held, released));
+    frame++;
   }
-  */
+}
 
-  eventsLastFrame.clear();
+void InputManager::BeginRecording(InputRecording& recording) {
+  this->recording = &recording;
+  this->replay = nullptr;
+  recording.Clear();
+  frame = 0;
+}
 
-#ifdef __ANDROID__
-    events.clear(); // TODO: what inputs get stuck in the event list on droid?
-    TouchArea::poll();
-#endif
+void InputManager::EndRecording() {
+  if (recording) {
+    recording->SetFrameCount(frame);
+  }
+
+  recording = nullptr;
+}
+
+void InputManager::BeginReplay(const InputRecording& recording) {
+  this->replay = &recording;
+  this->recording = nullptr;
+  frame = 0;
+  replayEntry = 0;
+}
+
+const bool InputManager::IsRecording() const {
+  return recording != nullptr;
+}
+
+const bool InputManager::IsReplaying() const {
+  return replay != nullptr;
+}
+
+const bool InputManager::IsReplayFinished() const {
+  return replay && replay->IsFinished(frame);
 }
 
 sf::Keyboard::Key InputManager::GetAnyKey()
@@ -528,11 +440,34 @@ const bool InputManager::ConvertKeyToString(const sf::Keyboard::Key key, std::st
 }
 
 bool InputManager::Has(InputEvent _event) {
-  return events.end() != find(events.begin(), events.end(), _event);
+  if (_event.action == InputAction::SIZE) return false;
+
+  switch (_event.state) {
+  case InputState::PRESSED:
+    return pressed.test((size_t)_event.action);
+  case InputState::HELD:
+    return held.test((size_t)_event.action);
+  case InputState::RELEASED:
+    return released.test((size_t)_event.action);
+  }
+
+  return false;
 }
 
 void InputManager::VirtualKeyEvent(InputEvent event) {
-  events.push_back(event);
+  if (event.action == InputAction::SIZE) return;
+
+  switch (event.state) {
+  case InputState::PRESSED:
+    pressed.set((size_t)event.action);
+    break;
+  case InputState::HELD:
+    held.set((size_t)event.action);
+    break;
+  case InputState::RELEASED:
+    released.set((size_t)event.action);
+    break;
+  }
 }
 
 void InputManager::BindRegainFocusEvent(std::function<void()> callback)
@@ -561,7 +496,7 @@ ConfigSettings InputManager::GetConfigSettings()
 }
 
 bool InputManager::Empty() {
-  return events.empty();
+  return pressed.none() && held.none() && released.none();
 }
 
 bool InputManager::IsConfigFileValid()
@@ -3,6 +3,8 @@
 #include <map>
 #include <functional>
 #include <SFML/Window/Event.hpp>
+#include <SFML/Window/Joystick.hpp>
+#include <SFML/Window/Keyboard.hpp>
 
 using std::map;
 using std::vector;
@@ -11,6 +13,7 @@ using std::vector;
 #include "bnConfigReader.h"
 #include "bnConfigWriter.h"
 #include "bnConfigSettings.h"
+#include "bnInputRecording.h"
 
 using std::map;
 using std::vector;
@@ -44,6 +47,8 @@ public:
    * Before this function ends, it will scan for any release events. If they are found,
    * they are cleared from the event list. If no release is found but a press is present,
    * the button state is transformed into a HELD state equivalent.
+   * 
+   * Each state is one bitset over InputAction so the resolution is a handful of word operations
    */
   void Update();
 
@@ -68,6 +73,8 @@ public:
   /**
    * @brief Creates a reference to the config reader object
    * @param config reader
+   * 
+   * Rebuilds the key and button lookup tables from the config's action names
    */
   void SupportConfigSettings(ConfigReader& reader);
   
@@ -142,6 +149,35 @@ public:
 
   ConfigSettings GetConfigSettings();
 
+  /**
+   * @brief Appends every following frame's events to recording
+   * @param recording cleared first. Must outlive the recording session.
+   */
+  void BeginRecording(InputRecording& recording);
+
+  /**
+   * @brief Stops appending to the recording and stamps its frame count
+   */
+  void EndRecording();
+
+  /**
+   * @brief Replaces device input with the recorded events starting next frame
+   * @param recording must outlive the replay
+   *
+   * The window is still polled so focus, resize and close keep working
+   */
+  void BeginReplay(const InputRecording& recording);
+
+  const bool IsRecording() const;
+  const bool IsReplaying() const;
+
+  /**
+   * @brief Query if a replay has fed every frame it recorded
+   *
+   * Check before Update() so the last recorded frame is still fed and simulated
+   */
+  const bool IsReplayFinished() const;
+
 private:
   sf::Keyboard::Key lastkey;
   Gamepad lastButton;
@@ -156,11 +192,24 @@ private:
    * @brief sets all initial input events to false
    */
   InputManager();
-  
-  vector<InputEvent> events; /*!< Current event list */
-  vector<InputEvent> eventsLastFrame; /*!< The even list prior to this update */
 
-  map<InputEvent, std::string> input; /*!< Maps controller events*/
+  /**
+   * @brief Fills the lookup tables from settings, or the default keys if there is no valid config
+   */
+  void BuildLookupTables();
+
+  /**
+   * @brief Actions bound to a gamepad button or one of the Gamepad axis directions
+   */
+  const InputActions& GetPairedActions(Gamepad button) const;
+
+  InputActions pressed; /*!< Actions pressed this frame */
+  InputActions held; /*!< Actions held since an earlier frame */
+  InputActions released; /*!< Actions released this frame */
+
+  InputActions keyboardActions[sf::Keyboard::KeyCount]; /*!< Actions bound to each key */
+  InputActions buttonActions[sf::Joystick::ButtonCount]; /*!< Actions bound to each gamepad button */
+  InputActions axisActions[4]; /*!< Actions bound to Gamepad::UP, LEFT, RIGHT and DOWN */
 
   ConfigSettings settings; /*!< Settings object*/
 
@@ -168,6 +217,11 @@ private:
   std::function<void()> onLoseFocus; /*!< How the application should respond to losing focus */
   std::function<void(int, int)> onResized; /*!< How the application should respond to resized */
 
+  InputRecording* recording; /*!< Non-null while recording */
+  const InputRecording* replay; /*!< Non-null while replaying */
+  uint32_t frame; /*!< Frames since recording or replay began */
+  size_t replayEntry; /*!< Next entry in the replay to feed */
+
 };
 
 /**
@@ -0,0 +1,160 @@
+#include "bnInputRecording.h"
+#include "bnLogger.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace {
+  constexpr int STATES_PER_ACTION = 3; /*!< PRESSED, HELD, RELEASED */
+  constexpr int ACTION_COUNT = (int)InputAction::SIZE;
+
+  static_assert(ACTION_COUNT * STATES_PER_ACTION <= 64, "Input actions no longer fit in the recording mask");
+}
+
+InputRecording::InputRecording() : seed(0), frameCount(0) {
+}
+
+void InputRecording::Clear() {
+  entries.clear();
+  frameCount = 0;
+}
+
+void InputRecording::Push(uint32_t frame, uint64_t actions) {
+  if (frame + 1 > frameCount) {
+    frameCount = frame + 1;
+  }
+
+  if (actions == 0) return;
+
+  entries.push_back({ frame, 0, actions });
+}
+
+bool InputRecording::Load(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+
+  if (!file.is_open()) {
+    Logger::Log("Input recording " + path + " could not be opened");
+    return false;
+  }
+
+  Header header{};
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+  if (!file || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+    Logger::Log("Input recording " + path + " is not version " + std::to_string(VERSION));
+    return false;
+  }
+
+  // Do not trust the entry count until the file is known to be that long
+  const std::streamoff start = file.tellg();
+  file.seekg(0, std::ios::end);
+  const std::streamoff available = file.tellg() - start;
+  file.seekg(start);
+
+  if (!file || available < 0 || (uint64_t)header.entryCount > (uint64_t)available / sizeof(Entry)) {
+    Logger::Log("Input recording " + path + " is truncated");
+    return false;
+  }
+
+  std::vector<Entry> loaded(header.entryCount);
+  file.read(reinterpret_cast<char*>(loaded.data()), (std::streamsize)(loaded.size() * sizeof(Entry)));
+
+  if (!file) {
+    Logger::Log("Input recording " + path + " is truncated");
+    return false;
+  }
+
+  seed = header.seed;
+  frameCount = header.frameCount;
+  entries = std::move(loaded);
+
+  return true;
+}
+
+bool InputRecording::Save(const std::string& path) const {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+  if (!file.is_open()) {
+    return false;
+  }
+
+  Header header{};
+  std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+  header.version = VERSION;
+  header.seed = seed;
+  header.frameCount = frameCount;
+  header.entryCount = (uint32_t)entries.size();
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(entries.data()), (std::streamsize)(entries.size() * sizeof(Entry)));
+
+  return file.good();
+}
+
+void InputRecording::SetSeed(uint64_t seed) {
+  this->seed = seed;
+}
+
+const uint64_t InputRecording::GetSeed() const {
+  return seed;
+}
+
+void InputRecording::SetFrameCount(uint32_t frames) {
+  frameCount = frames;
+}
+
+const uint32_t InputRecording::GetFrameCount() const {
+  return frameCount;
+}
+
+const std::vector<InputRecording::Entry>& InputRecording::GetEntries() const {
+  return entries;
+}
+
+const bool InputRecording::IsFinished(uint32_t frame) const {
+  return frame >= frameCount;
+}
+
+void InputRecording::Replay(uint32_t frame, size_t& entry, InputActions& pressed, InputActions& held, InputActions& released) const {
+  if (entry < entries.size() && entries[entry].frame == frame) {
+    Decode(entries[entry].actions, pressed, held, released);
+    entry++;
+  }
+  else {
+    pressed.reset();
+    held.reset();
+    released.reset();
+  }
+}
+
+uint64_t InputRecording::Encode(const InputActions& pressed, const InputActions& held, const InputActions& released) {
+  uint64_t actions = 0;
+
+  if (pressed.none() && held.none() && released.none()) return actions;
+
+  for (int action = 0; action < ACTION_COUNT; action++) {
+    const int bit = action * STATES_PER_ACTION;
+
+    if (pressed[action])  actions |= uint64_t(1) << (bit + InputState::PRESSED);
+    if (held[action])     actions |= uint64_t(1) << (bit + InputState::HELD);
+    if (released[action]) actions |= uint64_t(1) << (bit + InputState::RELEASED);
+  }
+
+  return actions;
+}
+
+void InputRecording::Decode(uint64_t actions, InputActions& pressed, InputActions& held, InputActions& released) {
+  pressed.reset();
+  held.reset();
+  released.reset();
+
+  if (actions == 0) return;
+
+  for (int action = 0; action < ACTION_COUNT; action++) {
+    const int bit = action * STATES_PER_ACTION;
+
+    pressed[action]  = (actions >> (bit + InputState::PRESSED)) & 1;
+    held[action]     = (actions >> (bit + InputState::HELD)) & 1;
+    released[action] = (actions >> (bit + InputState::RELEASED)) & 1;
+  }
+}
@@ -0,0 +1,109 @@
+/*! \file bnInputRecording.h */
+
+/*! \brief Compact per-frame stream of the input events the game saw
+ *
+ * Every frame the InputManager's final action sets (after press/held/release
+ * resolution) are packed into a 64 bit mask: 3 bits per InputAction,
+ * one for each of PRESSED, HELD and RELEASED. Only frames with input are stored.
+ *
+ * The file also stores the session seed so Random::MakeSeed() hands out the same
+ * seeds on replay, and the number of frames recorded so replays run the same length.
+ *
+ * Used with --record and --replay to play the same fight without a human at the controller.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bnInputEvent.h"
+
+class InputRecording {
+public:
+  static constexpr char MAGIC[4] = { 'O', 'N', 'B', 'I' };
+  static constexpr uint32_t VERSION = 1; /*!< Bump when the layout or action list changes */
+
+  struct Header {
+    char magic[4];
+    uint32_t version;
+    uint64_t seed;
+    uint32_t frameCount; /*!< Frames recorded, including frames without input */
+    uint32_t entryCount;
+  };
+
+  /*! \brief One frame that had input */
+  struct Entry {
+    uint32_t frame;
+    uint32_t reserved;
+    uint64_t actions; /*!< Encoded action sets */
+  };
+
+  InputRecording();
+
+  /**
+   * @brief Forgets every entry. Keeps the seed.
+   */
+  void Clear();
+
+  /**
+   * @brief Appends a frame. Frames must be pushed in increasing order.
+   * @param frame index since recording began
+   * @param actions encoded with Encode(). Empty masks are not stored.
+   */
+  void Push(uint32_t frame, uint64_t actions);
+
+  /**
+   * @brief Reads a recording from disk
+   * @return false if the file is missing, truncated or a different version
+   *
+   * The entry count in the header is checked against the file length before anything is allocated.
+   */
+  bool Load(const std::string& path);
+
+  /**
+   * @brief Writes the recording to disk
+   */
+  bool Save(const std::string& path) const;
+
+  void SetSeed(uint64_t seed);
+  const uint64_t GetSeed() const;
+
+  void SetFrameCount(uint32_t frames);
+  const uint32_t GetFrameCount() const;
+
+  const std::vector<Entry>& GetEntries() const;
+
+  /**
+   * @brief Query if frame is past the last recorded frame
+   *
+   * Check before polling a frame: frames 0 to GetFrameCount() - 1 are all replayed.
+   */
+  const bool IsFinished(uint32_t frame) const;
+
+  /**
+   * @brief Decodes the actions recorded for frame. Frames must be replayed in increasing order.
+   * @param frame index since the replay began
+   * @param entry index of the next unread entry, start at 0. Moved past frame's entry.
+   * @param pressed, held, released are overwritten. Empty if frame had no input.
+   */
+  void Replay(uint32_t frame, size_t& entry, InputActions& pressed, InputActions& held, InputActions& released) const;
+
+  /**
+   * @brief Packs one frame's action sets into an action mask
+   */
+  static uint64_t Encode(const InputActions& pressed, const InputActions& held, const InputActions& released);
+
+  /**
+   * @brief Unpacks an action mask into action sets
+   * @param actions mask from Encode()
+   * @param pressed, held, released are overwritten
+   */
+  static void Decode(uint64_t actions, InputActions& pressed, InputActions& held, InputActions& released);
+
+private:
+  uint64_t seed;
+  uint32_t frameCount;
+  std::vector<Entry> entries;
+};
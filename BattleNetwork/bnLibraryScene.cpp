@@ -410,10 +410,6 @@ void LibraryScene::onDraw(sf::RenderTexture& surface) {
 }
 
 void LibraryScene::onEnd() {
-  delete font;
-  delete chipFont;
-  delete chipDescFont;
-  delete numberFont;
   delete menuLabel;
   delete numberLabel;
   delete chipDesc;
@@ -20,19 +20,19 @@ private:
   Camera camera;
   AnimatedTextBox textbox; /*!< Display extra chip info*/
 
-  sf::Font* font; /*!< Menu name font */
+  std::shared_ptr<sf::Font> font; /*!< Menu name font */
   sf::Text* menuLabel; /*!< The menu text */
 
   double maxSelectInputCooldown; /*!< Max time to delay input */
   double selectInputCooldown; /*!< Current time left in input delay */
 
-  sf::Font *chipFont; /*!< Chip font */
+  std::shared_ptr<sf::Font> chipFont; /*!< Chip font */
   sf::Text *chipLabel; /*!< Chip text */
 
-  sf::Font *numberFont; /*!< Font for numbers */
+  std::shared_ptr<sf::Font> numberFont; /*!< Font for numbers */
   sf::Text *numberLabel; /*!< Numbers as text */
 
-  sf::Font *chipDescFont; /*!< Font used for chip desc */
+  std::shared_ptr<sf::Font> chipDescFont; /*!< Font used for chip desc */
   sf::Text* chipDesc; /*!< Actual chip desc */
 
   sf::Sprite bg; /*!< Background for this scene */
@@ -0,0 +1,218 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * @class LineTokenizer
+ * @author mav
+ * @date 16/10/26
+ * @brief Zero-copy, single pass reader for our line based `Tag key="value"` text files
+ *
+ * .animation files, library.txt, PA.txt and folders.txt all share the same layout:
+ *
+ * ```
+ * # comment
+ * Tag key="value" other="value with spaces" unquoted=12
+ * ```
+ *
+ * The tokenizer walks the buffer once and hands out views into it.
+ * Nothing is copied and the attribute list reuses its storage between lines.
+ * The buffer must outlive the tokenizer and any views taken from it.
+ *
+ * Empty lines and lines starting with `#` are skipped.
+ * A leading word without `=` is the line's tag. Otherwise the tag is empty e.g. `VERSION="2.0"`
+ */
+class LineTokenizer {
+public:
+  LineTokenizer(std::string_view buffer) : buffer(buffer), cursor(0) {
+  }
+
+  /**
+   * @brief Advance to the next line with content
+   * @return false when there are no more lines
+   */
+  bool Next() {
+    while (cursor < buffer.size()) {
+      size_t end = buffer.find('\n', cursor);
+
+      if (end == std::string_view::npos) {
+        end = buffer.size();
+      }
+
+      line = Trim(buffer.substr(cursor, end - cursor));
+      cursor = end + 1;
+
+      if (line.empty() || line[0] == '#') continue;
+
+      Tokenize();
+      return true;
+    }
+
+    line = std::string_view();
+    tag = std::string_view();
+    attributes.clear();
+
+    return false;
+  }
+
+  /**
+   * @brief The leading word of the current line
+   * @return tag or empty view if the line starts with an attribute
+   */
+  std::string_view Tag() const { return tag; }
+
+  /**
+   * @brief The whole current line with surrounding whitespace removed
+   */
+  std::string_view Line() const { return line; }
+
+  /**
+   * @brief Query if the current line has an attribute named key
+   */
+  bool Has(std::string_view key) const {
+    return Find(key) != nullptr;
+  }
+
+  /**
+   * @brief Get the value of an attribute on the current line
+   * @param key name of the attribute
+   * @param fallback returned if the attribute is missing
+   * @return view of the value without quotes
+   */
+  std::string_view Value(std::string_view key, std::string_view fallback = std::string_view()) const {
+    const std::string_view* value = Find(key);
+    return value ? *value : fallback;
+  }
+
+  /**
+   * @brief Get the value of an attribute on the current line as an int
+   * @return parsed value or fallback if the attribute is missing
+   */
+  int IntValue(std::string_view key, int fallback = 0) const {
+    const std::string_view* value = Find(key);
+
+    if (!value) return fallback;
+
+    char scratch[32];
+    return std::atoi(Terminate(*value, scratch));
+  }
+
+  /**
+   * @brief Get the value of an attribute on the current line as a float
+   * @return parsed value or fallback if the attribute is missing
+   */
+  float FloatValue(std::string_view key, float fallback = 0.f) const {
+    const std::string_view* value = Find(key);
+
+    if (!value) return fallback;
+
+    char scratch[32];
+    return (float)std::atof(Terminate(*value, scratch));
+  }
+
+private:
+  std::string_view buffer; /*!< The whole file */
+  size_t cursor; /*!< Start of the next line */
+  std::string_view line; /*!< Current line */
+  std::string_view tag; /*!< Current line's tag */
+  std::vector<std::pair<std::string_view, std::string_view>> attributes; /*!< Current line's key-value pairs */
+
+  static bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
+
+  static std::string_view Trim(std::string_view str) {
+    size_t start = 0;
+    size_t end = str.size();
+
+    while (start < end && IsSpace(str[start])) start++;
+    while (end > start && IsSpace(str[end - 1])) end--;
+
+    return str.substr(start, end - start);
+  }
+
+  /**
+   * @brief Copies a short value into scratch with a null terminator for the C conversion functions
+   */
+  static const char* Terminate(std::string_view value, char (&scratch)[32]) {
+    size_t len = value.size() < sizeof(scratch) - 1 ? value.size() : sizeof(scratch) - 1;
+    std::memcpy(scratch, value.data(), len);
+    scratch[len] = '\0';
+    return scratch;
+  }
+
+  const std::string_view* Find(std::string_view key) const {
+    for (auto& attribute : attributes) {
+      if (attribute.first == key) {
+        return &attribute.second;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void Tokenize() {
+    tag = std::string_view();
+    attributes.clear();
+
+    size_t i = 0;
+    bool first = true;
+
+    while (i < line.size()) {
+      while (i < line.size() && IsSpace(line[i])) i++;
+
+      if (i >= line.size()) break;
+
+      // Stray quoted text without a key is skipped
+      if (line[i] == '"') {
+        size_t close = line.find('"', i + 1);
+        i = close == std::string_view::npos ? line.size() : close + 1;
+        first = false;
+        continue;
+      }
+
+      size_t start = i;
+
+      while (i < line.size() && !IsSpace(line[i]) && line[i] != '=') i++;
+
+      std::string_view key = line.substr(start, i - start);
+
+      if (i >= line.size() || line[i] != '=') {
+        // A bare word. Only the first one is meaningful.
+        if (first) {
+          tag = key;
+        }
+
+        first = false;
+        continue;
+      }
+
+      i++; // skip '='
+
+      std::string_view value;
+
+      if (i < line.size() && line[i] == '"') {
+        size_t close = line.find('"', i + 1);
+
+        if (close == std::string_view::npos) {
+          close = line.size();
+        }
+
+        value = line.substr(i + 1, close - i - 1);
+        i = close + 1;
+      }
+      else {
+        start = i;
+        while (i < line.size() && !IsSpace(line[i])) i++;
+        value = line.substr(start, i - start);
+      }
+
+      attributes.emplace_back(key, value);
+      first = false;
+    }
+  }
+};
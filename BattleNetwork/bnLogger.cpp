@@ -1,6 +1,331 @@
 #include "bnLogger.h"
 
-// explicitely define static member variables
-std::mutex Logger::m;
-std::queue<std::string> Logger::logs = std::queue<std::string>();
-std::ofstream Logger::file;
\ No newline at end of file
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#if defined(__ANDROID__)
+#include <android/log.h>
+#endif
+
+namespace {
+  constexpr size_t RING_SIZE = 1024; /*!< Lines in flight. Must be a power of two */
+  constexpr size_t LINE_SIZE = 256; /*!< Longer lines are truncated */
+  constexpr size_t TAIL_SIZE = 64; /*!< Recent lines kept for the title screen */
+  constexpr int WRITER_SLEEP_MS = 5; /*!< How long the writer naps when the ring is empty */
+
+  static_assert((RING_SIZE & (RING_SIZE - 1)) == 0, "Log ring size must be a power of two");
+
+  struct Slot {
+    std::atomic<size_t> sequence; /*!< Which lap of the ring this slot is ready for */
+    LogLevel level;
+    LogCategory category;
+    char text[LINE_SIZE];
+  };
+
+  /*! \brief Bounded multi-producer single-consumer ring and the thread that drains it */
+  class LogWriter {
+  public:
+    LogWriter() : minLevel((int)LogLevel::Info), categories(~0u), dropped(0), head(0), tail(0), written(0), running(true), reportedDropped(0) {
+      for (size_t i = 0; i < RING_SIZE; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+      }
+
+      thread = std::thread(&LogWriter::Run, this);
+    }
+
+    ~LogWriter() {
+      running = false;
+
+      if (thread.joinable()) {
+        thread.join();
+      }
+
+      Drain();
+    }
+
+    const bool Accepts(LogLevel level, LogCategory category) const {
+      return (int)level >= minLevel.load(std::memory_order_relaxed)
+        && ((categories.load(std::memory_order_relaxed) >> (int)category) & 1u);
+    }
+
+    /**
+     * @brief Reserves the next free slot. Never waits on the writer.
+     * @return nullptr if the ring is full. The line is counted as dropped.
+     */
+    Slot* Claim(size_t& pos) {
+      pos = head.load(std::memory_order_relaxed);
+
+      for (;;) {
+        Slot& slot = slots[pos & (RING_SIZE - 1)];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+          if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+            return &slot;
+          }
+        }
+        else if (diff < 0) {
+          dropped.fetch_add(1, std::memory_order_relaxed);
+          return nullptr;
+        }
+        else {
+          pos = head.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /**
+     * @brief Hands a filled slot to the writer
+     */
+    void Publish(Slot* slot, size_t pos) {
+      slot->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    const bool GetNextLog(std::string& next) {
+      std::lock_guard<std::mutex> lock(tailMutex);
+
+      if (recent.empty()) return false;
+
+      next = std::move(recent.front());
+      recent.pop_front();
+
+      return true;
+    }
+
+    void Flush() {
+      size_t target = head.load(std::memory_order_acquire);
+
+      while (written.load(std::memory_order_acquire) < target) {
+        if (!running) {
+          Drain();
+          return;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+
+    void SetLevel(LogLevel level) {
+      minLevel = (int)level;
+    }
+
+    void SetCategoryEnabled(LogCategory category, bool enabled) {
+      if (enabled) {
+        categories |= (1u << (int)category);
+      }
+      else {
+        categories &= ~(1u << (int)category);
+      }
+    }
+
+    const unsigned GetDroppedCount() const {
+      return dropped.load(std::memory_order_relaxed);
+    }
+
+  private:
+    void Run() {
+      while (running) {
+        if (!Drain()) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(WRITER_SLEEP_MS));
+        }
+      }
+    }
+
+    /**
+     * @brief Writes everything published so far in one batch
+     * @return false if there was nothing to write
+     */
+    bool Drain() {
+      std::lock_guard<std::mutex> lock(drainMutex);
+
+      batch.clear();
+      size_t count = 0;
+
+      for (;;) {
+        size_t pos = tail.load(std::memory_order_relaxed);
+        Slot& slot = slots[pos & (RING_SIZE - 1)];
+
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) break;
+
+        std::string line = Prefix(slot.level, slot.category);
+        line += slot.text;
+
+        slot.sequence.store(pos + RING_SIZE, std::memory_order_release);
+        tail.store(pos + 1, std::memory_order_relaxed);
+
+#if defined(__ANDROID__)
+        __android_log_print(ANDROID_LOG_INFO, "open mmbn engine", "%s", line.c_str());
+#endif
+
+        batch += line;
+        batch += '\n';
+        count++;
+
+        std::lock_guard<std::mutex> tailLock(tailMutex);
+
+        recent.push_back(std::move(line));
+
+        if (recent.size() > TAIL_SIZE) {
+          recent.pop_front();
+        }
+      }
+
+      if (count == 0) return false;
+
+      unsigned lost = dropped.load(std::memory_order_relaxed);
+
+      if (lost != reportedDropped) {
+        batch += "Log ring full. Dropped " + std::to_string(lost - reportedDropped) + " lines\n";
+        reportedDropped = lost;
+      }
+
+#if !defined(__ANDROID__)
+      cerr << batch;
+      cerr.flush();
+#endif
+
+      if (!file.is_open()) {
+        file.open("log.txt");
+        file << "StartTime " << time(0) << '\n';
+      }
+
+      file << batch;
+      file.flush();
+
+      written.store(tail.load(std::memory_order_relaxed), std::memory_order_release);
+
+      return true;
+    }
+
+    static std::string Prefix(LogLevel level, LogCategory category) {
+      static const char* levels[] = { "DEBUG", "", "WARNING", "ERROR" };
+      static const char* names[] = { "", "resources", "animation", "battle", "input", "audio" };
+
+      std::string prefix;
+
+      if (level != LogLevel::Info) {
+        prefix += levels[(int)level];
+        prefix += ": ";
+      }
+
+      if (category != LogCategory::General) {
+        prefix += '[';
+        prefix += names[(int)category];
+        prefix += "] ";
+      }
+
+      return prefix;
+    }
+
+    std::atomic<int> minLevel; /*!< Runtime level filter */
+    std::atomic<unsigned> categories; /*!< Runtime category filter, one bit per LogCategory */
+    std::atomic<unsigned> dropped; /*!< Lines lost to a full ring */
+
+    Slot slots[RING_SIZE];
+    std::atomic<size_t> head; /*!< Next position producers claim */
+    std::atomic<size_t> tail; /*!< Next position the writer reads */
+    std::atomic<size_t> written; /*!< Every position before this is on disk */
+    std::atomic<bool> running;
+
+    std::mutex drainMutex; /*!< Only the writer thread or a final flush drains */
+    std::mutex tailMutex; /*!< Writer thread vs title screen */
+    std::deque<std::string> recent;
+    std::string batch;
+    unsigned reportedDropped; /*!< Dropped count already written to the log */
+    std::ofstream file;
+    std::thread thread;
+  };
+
+  static_assert(sizeof(LogCategory) == 1 && (int)LogCategory::SIZE <= 32, "Log categories no longer fit the category mask");
+
+  LogWriter& GetWriter() {
+    static LogWriter writer;
+    return writer;
+  }
+}
+
+void Logger::Write(LogLevel level, LogCategory category, const char* fmt, va_list args) {
+  LogWriter& writer = GetWriter();
+
+  if (!writer.Accepts(level, category)) return;
+
+  // Callers are often the game thread. A burst of any level drops lines rather than stalling it.
+  size_t pos;
+  Slot* slot = writer.Claim(pos);
+
+  if (!slot) return;
+
+  slot->level = level;
+  slot->category = category;
+
+  int size = vsnprintf(slot->text, LINE_SIZE, fmt, args);
+
+  if (size >= (int)LINE_SIZE) {
+    std::memcpy(slot->text + LINE_SIZE - 4, "...", 4);
+  }
+  else if (size < 0) {
+    slot->text[0] = '\0';
+  }
+
+  // Existing callers sometimes end their format with a newline. The writer adds its own.
+  size_t length = std::strlen(slot->text);
+
+  if (length && slot->text[length - 1] == '\n') {
+    slot->text[length - 1] = '\0';
+  }
+
+  writer.Publish(slot, pos);
+}
+
+const bool Logger::GetNextLog(std::string& next) {
+  return GetWriter().GetNextLog(next);
+}
+
+void Logger::Log(const string& _message) {
+  Log(LogLevel::Info, LogCategory::General, _message);
+}
+
+void Logger::Logf(const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  Write(LogLevel::Info, LogCategory::General, fmt, args);
+  va_end(args);
+}
+
+void Logger::Log(LogLevel level, LogCategory category, const string& _message) {
+  if (_message.empty()) return;
+
+  Logf(level, category, "%s", _message.c_str());
+}
+
+void Logger::Logf(LogLevel level, LogCategory category, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  Write(level, category, fmt, args);
+  va_end(args);
+}
+
+void Logger::SetLevel(LogLevel level) {
+  GetWriter().SetLevel(level);
+}
+
+void Logger::SetCategoryEnabled(LogCategory category, bool enabled) {
+  GetWriter().SetCategoryEnabled(category, enabled);
+}
+
+void Logger::Flush() {
+  GetWriter().Flush();
+}
+
+const unsigned Logger::GetDroppedCount() {
+  return GetWriter().GetDroppedCount();
+}
@@ -1,104 +1,117 @@
+/*! \file bnLogger.h */
+
 #pragma once
 #include <iostream>
 #include <string>
 #include <cstdarg>
-#include <queue>
-#include <mutex>
-#include <fstream>
-
-#if defined(__ANDROID__)
-#include <android/log.h>
-#endif
 
 using std::string;
 using std::to_string;
 using std::cerr;
 using std::endl;
 
-/*! \brief Thread safe logging utility logs directly to a file */
+/*! \brief How severe a log line is */
+enum class LogLevel : unsigned char {
+  Debug = 0,
+  Info,
+  Warning,
+  Error
+};
+
+/*! \brief What part of the engine a log line comes from */
+enum class LogCategory : unsigned char {
+  General = 0,
+  Resources,
+  Animation,
+  Battle,
+  Input,
+  Audio,
+  SIZE
+};
+
+/**
+ * Lines logged through the BN_LOG macros below BN_LOG_LEVEL or outside of
+ * the BN_LOG_CATEGORIES bit mask are compiled out, arguments included.
+ * Debug lines are compiled out unless the build asks for them.
+ */
+#ifndef BN_LOG_LEVEL
+#define BN_LOG_LEVEL 1
+#endif
+
+#ifndef BN_LOG_CATEGORIES
+#define BN_LOG_CATEGORIES 0xFFu
+#endif
+
+#define BN_LOG_ENABLED(level, category) \
+  ((int)LogLevel::level >= BN_LOG_LEVEL && ((BN_LOG_CATEGORIES >> (int)LogCategory::category) & 1u))
+
+#define BN_LOG(level, category, message) \
+  do { if (BN_LOG_ENABLED(level, category)) Logger::Log(LogLevel::level, LogCategory::category, message); } while (0)
+
+#define BN_LOGF(level, category, ...) \
+  do { if (BN_LOG_ENABLED(level, category)) Logger::Logf(LogLevel::level, LogCategory::category, __VA_ARGS__); } while (0)
+
+/*! \brief Thread safe logging utility
+ *
+ * Callers format their line into a slot of a fixed size lock-free ring buffer and return.
+ * A background thread drains the ring, writes batches to log.txt and the console,
+ * and keeps the last few lines for the title screen. Nothing on the calling thread
+ * allocates, locks, waits or touches the disk. If the ring is full the line is dropped
+ * and counted, whatever its level. The writer reports the count with its next batch.
+ */
 class Logger {
-private:
-  static std::mutex m;
-  static std::queue<std::string> logs; /*!< get the log stream in order */
-  static std::ofstream file; /*!< The file to write to */
 public:
-  static std::mutex* GetMutex() {
-    return &m;
-  }
-
   /**
-   * @brief Gets the next log and stores it in the input string
+   * @brief Gets the oldest line not yet read from the recent log tail
    * @param next input string to store result into
-   * @return true if there's more text. False if there's no text to input.
+   * @return true if a line was read. False if there's no text to input.
    */
-  static const bool GetNextLog(std::string &next) {
-    if (logs.size() == 0)
-      return false;
-
-    next = logs.front();
-    logs.pop();
-
-    return (logs.size()+1 > 0);
-  }
+  static const bool GetNextLog(std::string &next);
 
   /**
-   * @brief If first time opening, timestamps file and pushes message to file
+   * @brief Logs an info line in the general category
    * @param _message
    */
-  static void Log(string _message) {
-    if (_message.empty())
-      return;
-
-    if (!file.is_open()) {
-      file.open("log.txt");
-      file << "StartTime " << time(0) << endl;
-    }
-
-#if defined(__ANDROID__)
-    __android_log_print(ANDROID_LOG_INFO,"open mmbn engine","%s",_message.c_str());
-#else
-    cerr << _message << endl;
-#endif
+  static void Log(const string& _message);
 
-    logs.push(_message);
-    file << _message << endl;
-  }
-  
   /**
-   * @brief Uses varadic args to print any string format
+   * @brief Uses varadic args to print any string format as an info line in the general category
    * @param fmt string format
-   * @param ... input to match the format 
+   * @param ... input to match the format
    */
-  static void Logf(const char* fmt, ...) {
-    int size = 512;
-    char* buffer = 0;
-    buffer = new char[size];
-    va_list vl;
-    va_start(vl, fmt);
-    int nsize = vsnprintf(buffer, size, fmt, vl);
-    if (size <= nsize) {
-      delete[] buffer;
-      buffer = 0;
-      buffer = new char[nsize + 1];
-      nsize = vsnprintf(buffer, size, fmt, vl);
-    }
-    std::string ret(buffer);
-    va_end(vl);
-    delete[] buffer;
-    cerr << ret << endl;
-    logs.push(ret);
-
-#if defined(__ANDROID__)
-    __android_log_print(ANDROID_LOG_INFO,"open mmbn engine","%s",ret.c_str());
-#else
-    if (!file.is_open()) {
-      file.open("log.txt");
-      file << "StartTime " << time(0) << endl;
-    }
-
-    file << ret << endl;
-#endif
-  }
+  static void Logf(const char* fmt, ...);
+
+  /**
+   * @brief Logs a line if level and category pass the runtime filter
+   */
+  static void Log(LogLevel level, LogCategory category, const string& _message);
+
+  /**
+   * @brief Formats a line if level and category pass the runtime filter
+   *
+   * Lines longer than a ring slot are truncated
+   */
+  static void Logf(LogLevel level, LogCategory category, const char* fmt, ...);
+
+  /**
+   * @brief Lines below this level are ignored at runtime. Default is Info.
+   */
+  static void SetLevel(LogLevel level);
+
+  /**
+   * @brief Turns a category on or off at runtime. All are on by default.
+   */
+  static void SetCategoryEnabled(LogCategory category, bool enabled);
+
+  /**
+   * @brief Blocks until every line logged before the call is written to disk
+   */
+  static void Flush();
+
+  /**
+   * @brief Lines lost because the ring was full
+   */
+  static const unsigned GetDroppedCount();
 
   static string ToString(float _number) {
     return to_string(_number);
@@ -106,9 +119,6 @@ public:
 
 private:
   Logger() { ; }
-  
-  /**
-   * @brief Dumps queue and closes file
-   */
-  ~Logger() { file.close(); while (!logs.empty()) { logs.pop(); }  }
-};
\ No newline at end of file
+
+  static void Write(LogLevel level, LogCategory category, const char* fmt, va_list args);
+};
@@ -195,7 +195,7 @@ void MainMenuScene::onUpdate(double elapsed) {
     toggle = !toggle;
     showHUD = false;
     map->ToggleLighting(toggle);
-    map->AddLight(new Overworld::Light(owNavi.getPosition(), sf::Color(135+(120%rand()), 135+(120%rand()), 135+(120%rand()), 255), 10));
+    map->AddLight(new Overworld::Light(owNavi.getPosition(), sf::Color(135+random.Next(120), 135+random.Next(120), 135+random.Next(120), 255), 10));
   }*/
 
   // Keep menu selection in range
@@ -19,6 +19,7 @@
 #include "bnAnimation.h"
 #include "bnLanBackground.h"
 #include "bnChipFolderCollection.h"
+#include "bnRandom.h"
 #include <SFML/Graphics.hpp>
 #include <time.h>
 
@@ -43,6 +44,7 @@ private:
 
   Background* bg; /*!< Background image pointer */
   Overworld::Map* map; /*!< Overworld map pointer */ 
+  Random random; /*!< Presentation only, e.g. debug light colors. Never touches battle randomness. */
 
   SelectedNavi currentNavi; /*!< Current navi selection index */
   sf::Sprite owNavi; /*!< Overworld navi sprite */
@@ -93,7 +93,9 @@ private:
       // share HP across both peices
       this->SetHealth(base->GetHealth());
 
-      auto baseOffset = base->GetFirstComponent<AnimationComponent>()->GetPoint("head");
+      static const int HEAD_POINT = FramePoints::Intern("head");
+
+      auto baseOffset = base->GetFirstComponent<AnimationComponent>()->GetPoint(HEAD_POINT);
       auto origin = base->operator sf::Sprite &().getOrigin();
 
       // transform from sprite space to world space -- scale by 2
@@ -115,8 +117,8 @@ private:
           int y = 0;
 
           while (!nextTile) {
-            x = (rand() % 3) + 4;
-            y = (rand() % 3) + 1;
+            x = GetField()->GetRandom().Next(3) + 4;
+            y = GetField()->GetRandom().Next(3) + 1;
 
             nextTile = GetField()->GetAt(x, y);
 
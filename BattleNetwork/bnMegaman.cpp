@@ -7,12 +7,14 @@
 #include "bnTornadoChipAction.h"
 #include "bnPaletteSwap.h"
 
+// Forms look up the head point every frame
+static const int HEAD_POINT = FramePoints::Intern("Head");
+
 Megaman::Megaman() : Player() {
 
   auto base_palette = TEXTURES.LoadTextureFromFile("resources/navis/megaman/forms/base.palette.png");
   PaletteSwap* pswap = new PaletteSwap(this, *base_palette);
   RegisterComponent(pswap);
-  delete base_palette;
 
   SetHealth(900);
   SetName("Megaman");
@@ -74,7 +76,7 @@ void TenguCross::OnActivate(Player& player)
   overlayAnimation.Load();
   auto cross = TextureResourceManager::GetInstance().LoadTextureFromFile("resources/navis/megaman/forms/tengu_cross.png");
   overlay = new SpriteSceneNode();
-  overlay->setTexture(*cross);
+  overlay->setTexture(cross);
   overlay->SetLayer(-1);
   overlay->EnableParentShader(false);
 
@@ -110,7 +112,7 @@ void TenguCross::OnUpdate(float elapsed, Player& player)
   overlay->setColor(player.getColor());
 
   // update node position in the animation
-  auto baseOffset = parentAnim->GetPoint("Head");
+  auto baseOffset = parentAnim->GetPoint(HEAD_POINT);
   auto origin = player.getOrigin();
   baseOffset = baseOffset - origin;
 
@@ -146,7 +148,7 @@ void HeatCross::OnActivate(Player& player)
   overlayAnimation.Load();
   auto cross = TextureResourceManager::GetInstance().LoadTextureFromFile("resources/navis/megaman/forms/heat_cross.png");
   overlay = new SpriteSceneNode();
-  overlay->setTexture(*cross);
+  overlay->setTexture(cross);
   overlay->SetLayer(-1);
   overlay->EnableParentShader(false);
 
@@ -186,7 +188,7 @@ void HeatCross::OnUpdate(float elapsed, Player& player)
   overlayAnimation.Refresh(*overlay);
 
   // update node position in the animation
-  auto baseOffset = parentAnim->GetPoint("Head");
+  auto baseOffset = parentAnim->GetPoint(HEAD_POINT);
   auto origin = player.operator sf::Sprite &().getOrigin();
   baseOffset = baseOffset - origin;
 
@@ -223,7 +225,7 @@ void TomahawkCross::OnActivate(Player& player)
   overlayAnimation.Load();
   auto cross = TextureResourceManager::GetInstance().LoadTextureFromFile("resources/navis/megaman/forms/hawk_cross.png");
   overlay = new SpriteSceneNode();
-  overlay->setTexture(*cross);
+  overlay->setTexture(cross);
   overlay->SetLayer(-1);
   overlay->EnableParentShader(false);
 
@@ -259,7 +261,7 @@ void TomahawkCross::OnUpdate(float elapsed, Player& player)
   overlayAnimation.Refresh(*overlay);
 
   // update node position in the animation
-  auto baseOffset = parentAnim->GetPoint("Head");
+  auto baseOffset = parentAnim->GetPoint(HEAD_POINT);
   auto origin = player.operator sf::Sprite &().getOrigin();
   baseOffset = baseOffset - origin;
 
@@ -100,7 +100,7 @@ bool MetalMan::CanMoveTo(Battle::Tile * next)
 void MetalMan::OnUpdate(float _elapsed) {
   // TODO: use StuntDoubles to circumvent teleportaton
   if (movedByStun) { 
-    this->Teleport((rand() % 3) + 4, (rand() % 3) + 1); 
+    this->Teleport(GetField()->GetRandom().Next(3) + 4, GetField()->GetRandom().Next(3) + 1); 
     this->AdoptNextTile(); 
     this->FinishMove();
     movedByStun = false; 
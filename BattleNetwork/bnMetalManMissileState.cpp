@@ -43,7 +43,7 @@ void MetalManMissileState::OnUpdate(float _elapsed, MetalMan& metal) {
     if(metal.GetTarget() && metal.GetTarget()->GetTile()) {
         auto tile = metal.GetTarget()->GetTile();
         if(missileIndex % 2 == 0) {
-            tile = metal.GetField()->GetAt(1 + (rand() % 3), 1 + (rand() % 3));
+            tile = metal.GetField()->GetAt(1 + metal.GetField()->GetRandom().Next(3), 1 + metal.GetField()->GetRandom().Next(3));
         }
 
         auto missile = new Missile(metal.GetField(), metal.GetTeam(), tile, 0.4f);
@@ -28,7 +28,7 @@ void MetalManMoveState::OnUpdate(float _elapsed, MetalMan& metal) {
 
   do {
     // Find a new spot that is on our team
-    moved = metal.Teleport((rand() % 6) + 1, (rand() % 3) + 1);
+    moved = metal.Teleport(metal.GetField()->GetRandom().Next(6) + 1, metal.GetField()->GetRandom().Next(3) + 1);
     tries--;
   } while ((!moved || metal.GetNextTile()->GetTeam() != metal.GetTeam()) && tries > 0);
 
@@ -16,7 +16,7 @@ MetridMob::~MetridMob()
 }
 
 Mob* MetridMob::Build() {
-  int mobType = rand() % 3; 
+  int mobType = field->GetRandom().Next(3); 
 
   // 0 - metrid and cannodumb
   // 1 - 2 metrid and cannodumb of higher types
@@ -60,11 +60,11 @@ Mob* MetridMob::Build() {
     }
   }
 
-  Battle::Tile* tile = field->GetAt(1, (rand()%3)+1);
+  Battle::Tile* tile = field->GetAt(1, field->GetRandom().Next(3)+1);
   tile->SetState(TileState::EMPTY);
 
-  if (rand() % 10 < 5) {
-    Battle::Tile* tile = field->GetAt(3, (rand() % 3) + 1);
+  if (field->GetRandom().Next(10) < 5) {
+    Battle::Tile* tile = field->GetAt(3, field->GetRandom().Next(3) + 1);
     tile->SetState(TileState::EMPTY);
   }
 
@@ -46,7 +46,7 @@ void MetridMoveState::OnUpdate(float _elapsed, Metrid& met) {
   int teley = 0;
 
   if (myteam.size() > 0) {
-      int randIndex = rand() % myteam.size();
+      int randIndex = met.GetField()->GetRandom().Next((int)myteam.size());
       telex = myteam[randIndex]->GetX();
       teley = myteam[randIndex]->GetY();
   }
@@ -92,7 +92,8 @@ public:
       return nullptr;
     }
 
-    int random = rand() % possible.size();
+    // Draw from the battle's generator so rewards replay with the seed
+    int random = field->GetRandom().Next((int)possible.size());
 
     std::vector<BattleItem>::iterator possibleIter;
     possibleIter = possible.begin();
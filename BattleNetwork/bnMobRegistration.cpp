@@ -5,7 +5,7 @@
 #include <atomic>
 #include <thread>
 
-MobRegistration::MobMeta::MobMeta() : placeholderTexture(nullptr)
+MobRegistration::MobMeta::MobMeta() : placeholderTexture()
 {
   mobFactory = nullptr;
   name = "Unknown";
@@ -20,10 +20,6 @@ MobRegistration::MobMeta::~MobMeta()
   if (mobFactory) {
     delete mobFactory;
   }
-
-  if (placeholderTexture) {
-    delete placeholderTexture;
-  }
 }
 
 MobRegistration::MobMeta& MobRegistration::MobMeta::SetPlaceholderTexturePath(std::string path)
@@ -64,7 +60,7 @@ MobRegistration::MobMeta & MobRegistration::MobMeta::SetName(const std::string &
 
 const sf::Texture* MobRegistration::MobMeta::GetPlaceholderTexture() const
 {
-  return this->placeholderTexture;
+  return this->placeholderTexture.get();
 }
 
 const std::string MobRegistration::MobMeta::GetPlaceholderTexturePath() const
@@ -101,9 +97,9 @@ const std::string MobRegistration::MobMeta::GetAttackString() const
   return std::to_string(atk);
 }
 
-Mob * MobRegistration::MobMeta::GetMob() const
+Mob * MobRegistration::MobMeta::GetMob(uint64_t seed) const
 {
-  loadMobClass(); // Reload mob
+  loadMobClass(seed); // Reload mob
   return mobFactory->Build();
 }
 
@@ -142,11 +138,9 @@ const unsigned MobRegistration::Size()
 void MobRegistration::LoadAllMobs(std::atomic<int>& progress)
 {
   for (int i = 0; i < (int)Size(); i++) {
-    roster[i]->loadMobClass();
+    roster[i]->loadMobClass(Random::MakeSeed());
 
-    Logger::GetMutex()->lock();
     Logger::Logf("Loaded mob: %s", roster[i]->GetName().c_str());
-    Logger::GetMutex()->unlock();
 
     progress++;
   }
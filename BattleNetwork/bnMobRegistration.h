@@ -30,12 +30,12 @@ public:
     std::string name;       /*!< Name of the mob */
     std::string description;/*!< Description of mob that shows up in the text box */
     std::string placeholderPath; /*!< Path to the preview image */
-    sf::Texture* placeholderTexture; /*!< Texture of the preview image */
+    std::shared_ptr<sf::Texture> placeholderTexture; /*!< Texture of the preview image */
     int atk; /*!< Strength of mob to display */
     double speed; /*!< Speed of mob to display */
     int hp; /*!< Total health of mob to display */
 
-    std::function<void()> loadMobClass; /*!< Deferred mob loader function */
+    std::function<void(uint64_t seed)> loadMobClass; /*!< Deferred mob loader function. Seeds the new field. */
     public:
     /**
      * @brief Sets mob to temp data
@@ -139,9 +139,10 @@ public:
 
     /**
      * @brief Uses deferred loader to load MobFactory and build the mob
+     * @param seed seeds the battle field. The same seed builds and plays out the same battle.
      * @return Mob* to send to BattleScene
      */
-    Mob* GetMob() const;
+    Mob* GetMob(uint64_t seed = Random::MakeSeed()) const;
   };
 
 private:
@@ -204,13 +205,13 @@ public:
 template<class T>
 inline MobRegistration::MobMeta & MobRegistration::MobMeta::SetMobClass()
 {
-  loadMobClass = [this]() {
+  loadMobClass = [this](uint64_t seed) {
     if (mobFactory) {
       delete mobFactory;
       mobFactory = nullptr;
     }
 
-    this->mobFactory = new T(new Field(6, 3));
+    this->mobFactory = new T(new Field(6, 3, seed));
 
     if (!this->placeholderTexture) {
       this->placeholderTexture = TEXTURES.LoadTextureFromFile(this->GetPlaceholderTexturePath());
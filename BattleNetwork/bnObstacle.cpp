@@ -3,6 +3,8 @@
 #include "bnShaderResourceManager.h"
 
 Obstacle::Obstacle(Field* _field, Team _team) : Spell(_field, _team), Character()  {
+  Tag<Obstacle>(this);
+
   this->field = _field;
   this->team = _team;
 
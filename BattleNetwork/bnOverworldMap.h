@@ -5,6 +5,7 @@
 #include "bnCamera.h"
 #include "bnOverworldLight.h"
 #include "bnTile.h"
+#include "bnRandom.h"
 
 namespace Overworld {
   /*! \brief Structure to hold tile data */
@@ -17,8 +18,8 @@ namespace Overworld {
     /**
      * @brief Randomly choose a tile color to add variation
      */
-    void LoadTexture() { 
-      int randTex = rand() % 100;
+    void LoadTexture(Random& random) { 
+      int randTex = random.Next(100);
 
       if (randTex > 80) {
         texture = TEXTURES.GetTexture(TextureType::MAIN_MENU_OW2);
@@ -29,11 +30,11 @@ namespace Overworld {
     }
 
   public:
-    Tile() { pos = sf::Vector2f(0, 0); LoadTexture(); cleanup = false;  }
+    Tile(Random& random) { pos = sf::Vector2f(0, 0); LoadTexture(random); cleanup = false;  }
     Tile(const Tile& rhs) { texture = rhs.texture; pos = rhs.pos;  cleanup = false; }
 
     Tile(sf::Texture* _texture, sf::Vector2f pos = sf::Vector2f()) : pos(pos) { texture = _texture; cleanup = false; }
-    Tile(sf::Vector2f pos) : pos(pos) { LoadTexture(); cleanup = false;}
+    Tile(sf::Vector2f pos, Random& random) : pos(pos) { LoadTexture(random); cleanup = false;}
     ~Tile() { ; }
     const sf::Vector2f GetPos() const { return pos; }
     const sf::Texture& GetTexture() { return *texture; }
@@ -75,6 +76,7 @@ namespace Overworld {
     int cols, rows; /*!< map is made out of Cols x Rows tiles */
     int tileWidth, tileHeight; /*!< tile dimensions */
     Camera* cam; /*!< camera */
+    Random random; /*!< tile variation and anything else the map generates */
 
     /**
      * @brief Transforms an ortho vector into an isometric vector
@@ -1,6 +1,8 @@
 #include "bnPA.h"
 #include "bnLogger.h"
+#include "bnAssetPack.h"
 #include "bnFileUtil.h"
+#include "bnProfiler.h"
 #include <assert.h>
 #include <iostream>
 #include "bnChipLibrary.h"
@@ -24,81 +26,47 @@ PA::~PA()
 
 void PA::LoadPA()
 {
-  advances.clear();
-
-  string data = FileUtil::Read("resources/database/PA.txt");
+  PROFILE_ZONE("PA::LoadPA");
 
-  int endline = 0;
-  std::vector<PA::PAData::Required> currSteps;
-  std::string currPA;
-  std::string damage;
-  std::string icon;
-  std::string type;
+  advances.clear();
 
-  do {
-    endline = (int)data.find("\n");
-    string line = data.substr(0, endline);
+  const std::string path = "resources/database/PA.txt";
 
-    while (line.compare(0, 1, " ") == 0)
-      line.erase(line.begin()); // remove leading whitespaces
-    while (line.size() > 0 && line.compare(line.size() - 1, 1, " ") == 0)
-      line.erase(line.end() - 1); // remove trailing whitespaces
+  // Baked recipes were already validated when the pack was built
+  if (const AssetPack::Entry* entry = ASSETPACK.Find(path, AssetPack::EntryKind::programAdvance)) {
+    const AssetPack::RecipeRecord* recipes = ASSETPACK.GetRecipes(*entry);
 
-    if (line[0] == '#') {
-      // Skip comments
-      data = data.substr(endline + 1);
-      continue;
-    }
+    for (uint32_t i = 0; i < entry->count; i++) {
+      const AssetPack::RecipeRecord& recipe = recipes[i];
+      const AssetPack::StepRecord* steps = ASSETPACK.GetSteps(recipe);
 
-    if (line.find("PA") != string::npos) {
-      if (!currSteps.empty()) {
-        if (currSteps.size() > 1) {
-          Element elemType = ChipLibrary::GetElementFromStr(type);
+      std::vector<PA::PAData::Required> currSteps;
+      currSteps.reserve(recipe.stepCount);
 
-          advances.push_back(PA::PAData({ currPA, (unsigned)atoi(icon.c_str()), (unsigned)atoi(damage.c_str()), elemType, currSteps }));
-          currSteps.clear();
-        }
-        else {
-          Logger::Log("Error. PA \"" + currPA + "\": only has 1 required chip for recipe. PA's must have 2 or more chips. Skipping entry.");
-          currSteps.clear();
-        }
+      for (uint32_t j = 0; j < recipe.stepCount; j++) {
+        currSteps.push_back(PA::PAData::Required({ ASSETPACK.GetString(steps[j].name), (char)steps[j].code }));
       }
-      
-      currPA = valueOf("name", line);
-      damage = valueOf("damage", line);
-      icon = valueOf("iconIndex", line);
-      type = valueOf("type", line);
-    } else if (line.find("Chip") != string::npos) {
-      string name = valueOf("name", line);
-      string code = valueOf("code", line);
-
-      currSteps.push_back(PA::PAData::Required({ name,code[0] }));
-
-      //std::cout << "chip step: " << name << " " << code[0] << endl;
+
+      Element elemType = ChipLibrary::GetElementFromStr(ASSETPACK.GetString(recipe.type));
+      advances.push_back(PA::PAData({ ASSETPACK.GetString(recipe.name), recipe.icon, recipe.damage, elemType, std::move(currSteps) }));
     }
 
-    data = data.substr(endline + 1);
-  } while (endline > -1);
+    return;
+  }
 
-  if (currSteps.size() > 1) {
-    Element elemType = ChipLibrary::GetElementFromStr(type);
+  string data = FileUtil::Read(path);
 
-    //std::cout << "PA entry 2: " << currPA << " " << (unsigned)atoi(icon.c_str()) << " " << (unsigned)atoi(damage.c_str()) << " " << type << endl;
-    advances.push_back(PA::PAData({ currPA, (unsigned)atoi(icon.c_str()), (unsigned)atoi(damage.c_str()), elemType, currSteps }));
-    currSteps.clear();
-  }
-  else {
-    //std::cout << "Error. PA " + currPA + " only has 1 required chip for recipe. PA's must have 2 or more chips. Skipping entry.\n";
-    Logger::Log("Error. PA \"" + currPA + "\": only has 1 required chip for recipe. PA's must have 2 or more chips. Skipping entry.");
-    currSteps.clear();
-  }
-}
+  AssetParser::ParseProgramAdvance(data, [this](const AssetParser::Recipe& recipe) {
+    std::vector<PA::PAData::Required> currSteps;
+    currSteps.reserve(recipe.steps.size());
+
+    for (auto& step : recipe.steps) {
+      currSteps.push_back(PA::PAData::Required({ std::string(step.name), step.code }));
+    }
 
-std::string PA::valueOf(std::string _key, std::string _line){
-  int keyIndex = (int)_line.find(_key);
-  assert(keyIndex > -1 && "Key was not found in PA file.");
-  string s = _line.substr(keyIndex + _key.size() + 2);
-  return s.substr(0, s.find("\""));
+    Element elemType = ChipLibrary::GetElementFromStr(std::string(recipe.type));
+    advances.push_back(PA::PAData({ std::string(recipe.name), recipe.icon, recipe.damage, elemType, std::move(currSteps) }));
+  });
 }
 
 const PASteps PA::GetMatchingSteps()
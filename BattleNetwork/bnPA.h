@@ -60,14 +60,6 @@ public:
    */
   void LoadPA();
   
-  /**
-   * @brief Extracts the value for a key given a line
-   * @param _key to look for
-   * @param _line input string
-   * @return value of key
-   */
-  std::string valueOf(std::string _key, std::string _line);
-  
   /**
    * @brief Given a list of chips, generates a matching PA. 
    * @param input list of chips
@@ -29,7 +29,6 @@ void PaletteSwap::LoadPaletteTexture(std::string path)
 {
   auto texture = TextureResourceManager::GetInstance().LoadTextureFromFile(path);
   palette = *texture;
-  delete texture;
   paletteSwap->setUniform("palette", palette);
 
 }
@@ -50,8 +50,8 @@ ParticleImpact::ParticleImpact(ParticleImpact::Type type) : Artifact(nullptr)
 }
 
 void ParticleImpact::OnSpawn(Battle::Tile& tile) {
-  randOffset = sf::Vector2f(float(rand() % 10), float(rand() % 10));
-  randOffset.x *= rand() % 2 ? -1 : 1;
+  randOffset = sf::Vector2f(float(GetField()->GetRandom().Next(10)), float(GetField()->GetRandom().Next(10)));
+  randOffset.x *= GetField()->GetRandom().Next(2) ? -1 : 1;
   randOffset.y = randOffset.y - GetHeight();
 }
 
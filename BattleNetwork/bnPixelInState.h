@@ -105,11 +105,18 @@ void PixelInState<Any>::OnUpdate(float _elapsed, Any& e) {
 
   sf::IntRect t = e.getTextureRect();
   sf::Vector2u size = e.getTexture()->getSize();
-  pixelated.SetUniform("x", (float)t.left / (float)size.x);
-  pixelated.SetUniform("y", (float)t.top / (float)size.y);
-  pixelated.SetUniform("w", (float)t.width / (float)size.x);
-  pixelated.SetUniform("h", (float)t.height / (float)size.y);
-  pixelated.SetUniform("pixel_threshold", (float)(factor/400.f));
+  // Resolved once, these run every frame
+  static const SmartShader::UniformSlot xSlot = SmartShader::GetUniformSlot("x");
+  static const SmartShader::UniformSlot ySlot = SmartShader::GetUniformSlot("y");
+  static const SmartShader::UniformSlot wSlot = SmartShader::GetUniformSlot("w");
+  static const SmartShader::UniformSlot hSlot = SmartShader::GetUniformSlot("h");
+  static const SmartShader::UniformSlot thresholdSlot = SmartShader::GetUniformSlot("pixel_threshold");
+
+  pixelated.SetUniform(xSlot, (float)t.left / (float)size.x);
+  pixelated.SetUniform(ySlot, (float)t.top / (float)size.y);
+  pixelated.SetUniform(wSlot, (float)t.width / (float)size.x);
+  pixelated.SetUniform(hSlot, (float)t.height / (float)size.y);
+  pixelated.SetUniform(thresholdSlot, (float)(factor/400.f));
 }
 
 template<typename Any>
@@ -21,6 +21,8 @@ Player::Player()
   formSize(0),
   Character(Rank::_1)
 {
+  Tag<Player>(this);
+
   this->ChangeState<PlayerIdleState>();
   
   // The charge component is also a scene node
@@ -15,6 +15,7 @@
 #include <SFML/Graphics.hpp>
 #include <sstream>
 #include <vector>
+#include <memory>
 
 #include "bnBattleOverTrigger.h"
 #include "bnPlayer.h"
@@ -69,7 +70,7 @@ private:
   Player* player; /*!< target entity of type Player */
   mutable Sprite glyphs; /*!< bitmap image object to draw */
   Sprite sprite; /*!< the box surrounding the health */
-  Texture* texture; /*!< the texture of the box */
+  std::shared_ptr<Texture> texture; /*!< the texture of the box */
 
   /**
    * @class Color
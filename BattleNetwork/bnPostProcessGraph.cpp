@@ -0,0 +1,224 @@
+#include "bnPostProcessGraph.h"
+#include "bnEngine.h"
+#include "bnProfiler.h"
+
+PostProcessPass::PostProcessPass(const std::string& name, sf::Shader* shader) : name(name), enabled(true) {
+  this->shader = shader;
+}
+
+PostProcessPass& PostProcessPass::Read(const std::string& uniform, const std::string& source) {
+  bindings.push_back(Binding{ uniform, source, nullptr });
+  return *this;
+}
+
+PostProcessPass& PostProcessPass::Read(const std::string& uniform, const sf::Texture& texture) {
+  bindings.push_back(Binding{ uniform, std::string(), &texture });
+  return *this;
+}
+
+PostProcessPass& PostProcessPass::WriteTo(const std::string& name) {
+  output = name;
+  return *this;
+}
+
+PostProcessPass& PostProcessPass::SetEnabled(bool enabled) {
+  this->enabled = enabled;
+  return *this;
+}
+
+const bool PostProcessPass::IsEnabled() const {
+  return enabled;
+}
+
+const std::string& PostProcessPass::GetName() const {
+  return name;
+}
+
+const bool PostProcessPass::ReadsScene() const {
+  for (auto& binding : bindings) {
+    if (!binding.texture && binding.source == "scene") return true;
+  }
+
+  return false;
+}
+
+PostProcessGraph::PostProcessGraph() {
+}
+
+PostProcessGraph::~PostProcessGraph() {
+  for (auto pass : passes) {
+    delete pass;
+  }
+
+  passes.clear();
+}
+
+PostProcessPass& PostProcessGraph::AddPass(const std::string& name, sf::Shader* shader) {
+  passes.push_back(new PostProcessPass(name, shader));
+  return *passes.back();
+}
+
+PostProcessPass* PostProcessGraph::GetPass(const std::string& name) {
+  for (auto pass : passes) {
+    if (pass->name == name) return pass;
+  }
+
+  return nullptr;
+}
+
+void PostProcessGraph::SetInput(const std::string& name, const sf::Texture* texture) {
+  for (auto iter = inputs.begin(); iter != inputs.end(); iter++) {
+    if (iter->first != name) continue;
+
+    if (texture) {
+      iter->second = texture;
+    }
+    else {
+      inputs.erase(iter);
+    }
+
+    return;
+  }
+
+  if (texture) {
+    inputs.emplace_back(name, texture);
+  }
+}
+
+const bool PostProcessGraph::HasEnabledPasses() const {
+  for (auto pass : passes) {
+    if (pass->enabled) return true;
+  }
+
+  return false;
+}
+
+void PostProcessGraph::Run(sf::RenderTexture& surface) {
+  PROFILE_ZONE("PostProcessGraph::Run");
+
+  // Keep the passes that have everything they read, in order
+  runnable.clear();
+
+  for (auto pass : passes) {
+    if (!pass->enabled) continue;
+
+    bool ready = true;
+
+    for (auto& binding : pass->bindings) {
+      if (binding.texture || binding.source == "scene") continue;
+
+      bool found = false;
+
+      for (auto& input : inputs) {
+        if (input.first == binding.source) { found = true; break; }
+      }
+
+      for (size_t i = 0; !found && i < runnable.size(); i++) {
+        found = runnable[i]->output == binding.source;
+      }
+
+      if (!found) { ready = false; break; }
+    }
+
+    if (ready) {
+      runnable.push_back(pass);
+    }
+  }
+
+  if (runnable.empty()) return;
+
+  PostProcessPass* last = nullptr;
+
+  for (auto pass : runnable) {
+    if (pass->output.empty()) last = pass;
+  }
+
+  surface.display(); // ready the scene to be sampled
+
+  const sf::Vector2u size = surface.getSize();
+  const sf::View view = surface.getView();
+  const sf::Texture* source = &surface.getTexture();
+  bool onSurface = true; /* the latest result is the surface itself */
+
+  for (auto pass : runnable) {
+    if (!pass->output.empty()) {
+      sf::RenderTexture* target = ENGINE.AcquireRenderTarget(size);
+      Draw(*pass, *source, *target, surface);
+      target->display();
+
+      outputs.emplace_back(pass->output, target);
+      continue;
+    }
+
+    if (pass == last && !onSurface && !pass->ReadsScene()) {
+      // Nothing samples the surface anymore so the last pass draws straight onto it
+      surface.setView(surface.getDefaultView());
+      Draw(*pass, *source, surface, surface);
+      surface.setView(view);
+      surface.display();
+
+      source = &surface.getTexture();
+      onSurface = true;
+      continue;
+    }
+
+    chain.Acquire(size);
+    Draw(*pass, *source, chain.GetBack(), surface);
+    chain.Swap();
+
+    source = &chain.GetFront().getTexture();
+    onSurface = false;
+  }
+
+  if (!onSurface) {
+    // The result is still in a pooled target
+    surface.setView(surface.getDefaultView());
+    surface.draw(sf::Sprite(*source), sf::RenderStates(sf::BlendNone));
+    surface.setView(view);
+  }
+
+  for (auto& output : outputs) {
+    ENGINE.ReleaseRenderTarget(output.second);
+  }
+
+  outputs.clear();
+  chain.Release();
+}
+
+const sf::Texture* PostProcessGraph::Find(const std::string& name, const sf::RenderTexture& surface) const {
+  if (name == "scene") {
+    return &surface.getTexture();
+  }
+
+  for (auto& input : inputs) {
+    if (input.first == name) return input.second;
+  }
+
+  for (auto& output : outputs) {
+    if (output.first == name) return &output.second->getTexture();
+  }
+
+  return nullptr;
+}
+
+void PostProcessGraph::Draw(PostProcessPass& pass, const sf::Texture& source, sf::RenderTarget& target, const sf::RenderTexture& surface) {
+  sf::RenderStates states(sf::BlendNone);
+  sf::Shader* program = pass.shader.Get();
+
+  if (program) {
+    program->setUniform("texture", sf::Shader::CurrentTexture);
+
+    for (auto& binding : pass.bindings) {
+      const sf::Texture* texture = binding.texture ? binding.texture : Find(binding.source, surface);
+
+      if (texture) {
+        program->setUniform(binding.uniform, *texture);
+      }
+    }
+
+    pass.shader.ApplyUniforms();
+    states.shader = program;
+  }
+
+  target.draw(sf::Sprite(source), states);
+}
@@ -0,0 +1,171 @@
+/*! \file bnPostProcessGraph.h */
+
+/*! \brief Full screen shader passes described once and run once per frame
+ *
+ * Engine draws take one shader each. Effects that sample the whole screen,
+ * like heat distortion, used to copy the render surface into a new texture
+ * every time they ran. A graph describes those effects up front as a list of
+ * passes that Engine::PostProcess() runs over pooled targets.
+ *
+ * Each pass draws a full screen image through its shader. It reads the result
+ * of the pass before it, or the render surface for the first pass, and its
+ * result feeds the next one. The final result ends up back on the surface.
+ * The source is always bound to the `texture` sampler.
+ *
+ * A pass can sample other images by name through Read():
+ *   - "scene": the surface as it was before any pass ran
+ *   - an input set with SetInput(), like a mask drawn this frame
+ *   - the result of an earlier pass given a name with WriteTo()
+ *
+ * A pass that reads a name with nothing behind it this frame is skipped.
+ */
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bnSmartShader.h"
+#include "bnRenderTargetPool.h"
+
+class PostProcessPass {
+  friend class PostProcessGraph;
+
+public:
+  /**
+   * @brief Bind a sampler uniform to an image by name. Looked up every run.
+   * @param uniform name of the sampler in the shader
+   * @param source "scene", an input or a named pass result
+   * @return PostProcessPass& for chaining
+   */
+  PostProcessPass& Read(const std::string& uniform, const std::string& source);
+
+  /**
+   * @brief Bind a sampler uniform to a texture the graph does not own
+   * @param uniform name of the sampler in the shader
+   * @param texture must outlive the graph
+   * @return PostProcessPass& for chaining
+   */
+  PostProcessPass& Read(const std::string& uniform, const sf::Texture& texture);
+
+  /**
+   * @brief Keep the result under name for later passes instead of feeding the next pass
+   * @return PostProcessPass& for chaining
+   */
+  PostProcessPass& WriteTo(const std::string& name);
+
+  /**
+   * @brief Set a uniform for this pass only. Uploaded only when it changes.
+   * @return PostProcessPass& for chaining
+   */
+  template<typename T>
+  PostProcessPass& SetUniform(const std::string& uniform, const T& value);
+
+  template<typename T>
+  PostProcessPass& SetUniform(SmartShader::UniformSlot slot, const T& value);
+
+  /**
+   * @brief Disabled passes are skipped. A graph with no enabled pass costs nothing.
+   * @return PostProcessPass& for chaining
+   */
+  PostProcessPass& SetEnabled(bool enabled);
+
+  const bool IsEnabled() const;
+
+  const std::string& GetName() const;
+
+private:
+  PostProcessPass(const std::string& name, sf::Shader* shader);
+
+  /**
+   * @brief Query if the pass samples the surface as it was before the graph ran
+   */
+  const bool ReadsScene() const;
+
+  struct Binding {
+    std::string uniform;
+    std::string source; /*!< Empty if texture is set */
+    const sf::Texture* texture;
+  };
+
+  std::string name;
+  std::string output; /*!< Empty if the result feeds the next pass */
+  SmartShader shader; /*!< Program and per pass uniform values */
+  std::vector<Binding> bindings;
+  bool enabled;
+};
+
+class PostProcessGraph {
+public:
+  PostProcessGraph();
+
+  /**
+   * @brief Deletes the passes
+   */
+  ~PostProcessGraph();
+
+  PostProcessGraph(const PostProcessGraph&) = delete;
+  PostProcessGraph& operator=(const PostProcessGraph&) = delete;
+
+  /**
+   * @brief Appends a pass. Passes run in the order they were added.
+   * @param name used by GetPass()
+   * @param shader program the pass draws through
+   * @return PostProcessPass& valid as long as the graph
+   */
+  PostProcessPass& AddPass(const std::string& name, sf::Shader* shader);
+
+  /**
+   * @brief Fetch a pass by name
+   * @return PostProcessPass* or nullptr
+   */
+  PostProcessPass* GetPass(const std::string& name);
+
+  /**
+   * @brief Makes a texture readable by name for the next runs
+   * @param texture nullptr removes the input
+   */
+  void SetInput(const std::string& name, const sf::Texture* texture);
+
+  /**
+   * @brief Query if any pass would run
+   */
+  const bool HasEnabledPasses() const;
+
+  /**
+   * @brief Runs every enabled pass over the surface and leaves the result on it
+   * @param surface displayed first so it can be sampled
+   */
+  void Run(sf::RenderTexture& surface);
+
+private:
+  /**
+   * @brief Resolve a name to a texture
+   * @return nullptr if nothing is behind the name yet
+   */
+  const sf::Texture* Find(const std::string& name, const sf::RenderTexture& surface) const;
+
+  /**
+   * @brief Draws source into target through the pass shader
+   */
+  void Draw(PostProcessPass& pass, const sf::Texture& source, sf::RenderTarget& target, const sf::RenderTexture& surface);
+
+  std::vector<PostProcessPass*> passes; /*!< Heap allocated so references from AddPass() stay valid */
+  std::vector<std::pair<std::string, const sf::Texture*>> inputs;
+  std::vector<std::pair<std::string, sf::RenderTexture*>> outputs; /*!< Named results, borrowed for one run */
+  std::vector<PostProcessPass*> runnable; /*!< Passes that run this frame. Kept to avoid allocating. */
+  PingPongTarget chain; /*!< Where results that feed the next pass go */
+};
+
+template<typename T>
+inline PostProcessPass& PostProcessPass::SetUniform(const std::string& uniform, const T& value) {
+  shader.SetUniform(uniform, value);
+  return *this;
+}
+
+template<typename T>
+inline PostProcessPass& PostProcessPass::SetUniform(SmartShader::UniformSlot slot, const T& value) {
+  shader.SetUniform(slot, value);
+  return *this;
+}
@@ -0,0 +1,213 @@
+#include "bnProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace {
+  const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+  void WriteJSONString(std::ofstream& out, const char* str) {
+    out << '"';
+
+    for (; *str; str++) {
+      if (*str == '"' || *str == '\\') out << '\\';
+      out << *str;
+    }
+
+    out << '"';
+  }
+}
+
+Profiler::Zone::Zone(const char* name) : name(name), start(Profiler::Now()) {
+}
+
+Profiler::Zone::~Zone() {
+  PROFILER.Record(name, start, Profiler::Now());
+}
+
+Profiler& Profiler::GetInstance() {
+  static Profiler instance;
+  return instance;
+}
+
+int64_t Profiler::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+Profiler::Profiler() : frame(0) {
+  scratch.reserve(RING_SIZE);
+}
+
+Profiler::~Profiler() {
+}
+
+Profiler::ThreadBuffer& Profiler::GetThreadBuffer() {
+  thread_local ThreadBuffer* local = nullptr;
+
+  if (!local) {
+    // Only the first sample of each thread takes the lock
+    std::lock_guard<std::mutex> lock(mutex);
+
+    threads.push_back(std::make_unique<ThreadBuffer>());
+    local = threads.back().get();
+    local->id = (uint32_t)threads.size();
+    local->name = "Thread " + std::to_string(local->id);
+    local->samples.reset(new Sample[RING_SIZE]);
+  }
+
+  return *local;
+}
+
+void Profiler::Record(const char* zone, int64_t start, int64_t end) {
+  ThreadBuffer& buffer = GetThreadBuffer();
+  uint64_t index = buffer.written.load(std::memory_order_relaxed);
+
+  buffer.samples[index & (RING_SIZE - 1)] = Sample{ zone, start, end };
+  buffer.written.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const std::string& name) {
+  ThreadBuffer& buffer = GetThreadBuffer();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  buffer.name = name;
+}
+
+void Profiler::Read(ThreadBuffer& buffer, uint64_t& from, std::vector<Sample>& out) {
+  uint64_t written = buffer.written.load(std::memory_order_acquire);
+
+  if (written - from > RING_SIZE) {
+    from = written - RING_SIZE;
+  }
+
+  size_t first = out.size();
+
+  for (uint64_t i = from; i < written; i++) {
+    out.push_back(buffer.samples[i & (RING_SIZE - 1)]);
+  }
+
+  // The owner keeps writing while we copy. Drop anything it may have lapped,
+  // including the slot it could be writing right now.
+  uint64_t after = buffer.written.load(std::memory_order_acquire);
+
+  if (after + 1 > from + RING_SIZE) {
+    size_t lost = (size_t)std::min<uint64_t>(after + 1 - RING_SIZE - from, written - from);
+    out.erase(out.begin() + first, out.begin() + first + lost);
+  }
+
+  from = written;
+}
+
+Profiler::ZoneHistory& Profiler::FindHistory(const char* zone) {
+  for (auto& h : history) {
+    // The same literal may have a different address in another translation unit
+    if (h.zone == zone || std::strcmp(h.zone, zone) == 0) {
+      return h;
+    }
+  }
+
+  ZoneHistory h{};
+  h.zone = zone;
+  history.push_back(h);
+
+  return history.back();
+}
+
+void Profiler::EndFrame() {
+  scratch.clear();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto& thread : threads) {
+      Read(*thread, thread->consumed, scratch);
+    }
+  }
+
+  for (auto& sample : scratch) {
+    ZoneHistory& h = FindHistory(sample.zone);
+    h.current += (float)(sample.end - sample.start) / 1000000.f;
+    h.currentCalls++;
+  }
+
+  unsigned slot = frame % WINDOW;
+
+  for (auto& h : history) {
+    h.calls -= h.callsPerFrame[slot];
+    h.frames[slot] = h.current;
+    h.callsPerFrame[slot] = h.currentCalls;
+    h.calls += h.currentCalls;
+    h.current = 0;
+    h.currentCalls = 0;
+  }
+
+  frame++;
+}
+
+std::vector<Profiler::ZoneStats> Profiler::GetStats() const {
+  std::vector<ZoneStats> stats;
+  unsigned count = std::min(frame, WINDOW);
+
+  if (count == 0) return stats;
+
+  stats.reserve(history.size());
+
+  float sorted[WINDOW];
+
+  for (auto& h : history) {
+    std::copy(h.frames, h.frames + count, sorted);
+    std::sort(sorted, sorted + count);
+
+    auto percentile = [&sorted, count](float p) { return sorted[(unsigned)(p * (count - 1))]; };
+
+    stats.push_back(ZoneStats{ h.zone, percentile(0.5f), percentile(0.95f), percentile(0.99f), sorted[count - 1], (float)h.calls / (float)count });
+  }
+
+  std::sort(stats.begin(), stats.end(), [](const ZoneStats& a, const ZoneStats& b) { return a.p95 > b.p95; });
+
+  return stats;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path) {
+  std::ofstream out(path);
+
+  if (!out.is_open()) return false;
+
+  std::vector<Sample> samples;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  out << "{\"traceEvents\":[\n";
+
+  bool first = true;
+
+  for (auto& thread : threads) {
+    if (!first) out << ",\n";
+    first = false;
+
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->id << ",\"args\":{\"name\":";
+    WriteJSONString(out, thread->name.c_str());
+    out << "}}";
+
+    uint64_t from = 0;
+    samples.clear();
+    Read(*thread, from, samples);
+
+    out.setf(std::ios::fixed);
+    out.precision(3);
+
+    for (auto& sample : samples) {
+      // Trace timestamps are in microseconds
+      out << ",\n{\"name\":";
+      WriteJSONString(out, sample.zone);
+      out << ",\"cat\":\"bn\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->id
+          << ",\"ts\":" << (double)sample.start / 1000.0
+          << ",\"dur\":" << (double)(sample.end - sample.start) / 1000.0 << "}";
+    }
+  }
+
+  out << "\n]}\n";
+
+  return out.good();
+}
@@ -0,0 +1,155 @@
+/*! \file bnProfiler.h */
+
+/*! \brief Low overhead scoped timers to attribute frame time to engine code
+ *
+ * Wrap hot code in PROFILE_ZONE("Name") and the enclosing scope is timed.
+ * Each thread writes its samples into its own fixed size ring buffer without locking.
+ * Once per frame the main thread calls EndFrame() to fold the new samples into
+ * rolling per-zone frame totals. These feed the overlay percentiles.
+ *
+ * The most recent samples of every thread can be exported to a Chrome trace
+ * (chrome://tracing or https://ui.perfetto.dev) to inspect a spike frame by frame.
+ *
+ * Zones compile out entirely when BN_PROFILE is 0.
+ */
+
+#pragma once
+
+#ifndef BN_PROFILE
+#define BN_PROFILE 1
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Profiler {
+public:
+  static constexpr unsigned RING_SIZE = 1u << 14; /*!< Samples kept per thread. Must be a power of 2 */
+  static constexpr unsigned WINDOW = 120; /*!< Frames used for the rolling percentiles */
+
+  /*! \brief One timed scope. Times are nanoseconds since the profiler started */
+  struct Sample {
+    const char* zone;
+    int64_t start;
+    int64_t end;
+  };
+
+  /*! \brief Per-frame time spent in a zone over the last WINDOW frames, in milliseconds */
+  struct ZoneStats {
+    const char* zone;
+    float p50, p95, p99, max;
+    float callsPerFrame;
+  };
+
+  /**
+   * @class Zone
+   * @brief Times the scope it lives in. Use PROFILE_ZONE() instead so it can compile out.
+   */
+  class Zone {
+  public:
+    Zone(const char* name);
+    ~Zone();
+
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+
+  private:
+    const char* name; /*!< Must be a string literal */
+    int64_t start;
+  };
+
+  /**
+   * @brief If this is the first call, starts the profiler clock
+   * @return Profiler&
+   */
+  static Profiler& GetInstance();
+
+  /**
+   * @brief Nanoseconds since the profiler started
+   */
+  static int64_t Now();
+
+  /**
+   * @brief Writes a sample into the calling thread's ring buffer
+   * @param zone string literal naming the zone
+   */
+  void Record(const char* zone, int64_t start, int64_t end);
+
+  /**
+   * @brief Names the calling thread in trace exports
+   */
+  void SetThreadName(const std::string& name);
+
+  /**
+   * @brief Folds samples recorded since the last call into the rolling frame totals
+   *
+   * Call once per frame from the main thread
+   */
+  void EndFrame();
+
+  /**
+   * @brief Rolling percentiles of every zone seen so far, slowest p95 first
+   */
+  std::vector<ZoneStats> GetStats() const;
+
+  /**
+   * @brief Writes the samples still held by every ring buffer as Chrome trace JSON
+   * @param path file to write
+   * @return false if the file could not be written
+   */
+  bool ExportChromeTrace(const std::string& path);
+
+private:
+  Profiler();
+  ~Profiler();
+
+  /*! \brief Written by the owning thread only. Read by the main thread. */
+  struct ThreadBuffer {
+    uint32_t id;
+    std::string name;
+    std::unique_ptr<Sample[]> samples;
+    std::atomic<uint64_t> written{ 0 }; /*!< Total samples ever written. Published after the sample */
+    uint64_t consumed = 0; /*!< Samples already folded by EndFrame() */
+  };
+
+  struct ZoneHistory {
+    const char* zone;
+    float frames[WINDOW]; /*!< Milliseconds per frame */
+    float current; /*!< Milliseconds this frame */
+    unsigned calls; /*!< Calls over the whole window */
+    unsigned callsPerFrame[WINDOW];
+    unsigned currentCalls;
+  };
+
+  ThreadBuffer& GetThreadBuffer();
+
+  /**
+   * @brief Appends the samples from index `from` on that have not been overwritten
+   * @param from first sample index to read. Advanced past the last sample read.
+   */
+  void Read(ThreadBuffer& buffer, uint64_t& from, std::vector<Sample>& out);
+
+  ZoneHistory& FindHistory(const char* zone);
+
+  std::mutex mutex; /*!< Guards the thread list */
+  std::vector<std::unique_ptr<ThreadBuffer>> threads;
+  std::vector<ZoneHistory> history;
+  std::vector<Sample> scratch; /*!< Reused by EndFrame() */
+  unsigned frame;
+};
+
+/*! \brief Shorthand to get instance of the profiler */
+#define PROFILER Profiler::GetInstance()
+
+#if BN_PROFILE
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+/*! \brief Times the rest of the enclosing scope under name */
+#define PROFILE_ZONE(name) Profiler::Zone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name)
+#endif
@@ -0,0 +1,57 @@
+#include "bnProfilerOverlay.h"
+
+#include <cstdio>
+#include <string>
+
+ProfilerOverlay::ProfilerOverlay(const std::shared_ptr<sf::Font>& font) : font(font), frames(0), visible(false) {
+  text.setFont(*font);
+  text.setCharacterSize(10);
+  text.setFillColor(sf::Color::White);
+  text.setPosition(6.f, 4.f);
+
+  background.setFillColor(sf::Color(0, 0, 0, 180));
+  background.setPosition(2.f, 2.f);
+}
+
+ProfilerOverlay::~ProfilerOverlay() {
+}
+
+void ProfilerOverlay::Update() {
+  if (!visible) return;
+
+  if (frames++ % REFRESH_FRAMES != 0) return;
+
+  auto stats = PROFILER.GetStats();
+
+  std::string table = "zone                          p50    p95    p99    max  calls\n";
+  char row[128];
+
+  for (unsigned i = 0; i < stats.size() && i < MAX_ROWS; i++) {
+    auto& zone = stats[i];
+    std::snprintf(row, sizeof(row), "%-28.28s %6.2f %6.2f %6.2f %6.2f %6.1f\n", zone.zone, zone.p50, zone.p95, zone.p99, zone.max, zone.callsPerFrame);
+    table += row;
+  }
+
+  text.setString(table);
+
+  sf::FloatRect bounds = text.getLocalBounds();
+  background.setSize(sf::Vector2f(bounds.width + 10.f, bounds.height + 10.f));
+}
+
+void ProfilerOverlay::Toggle() {
+  visible = !visible;
+
+  // Refresh on the next update
+  frames = 0;
+}
+
+const bool ProfilerOverlay::IsVisible() const {
+  return visible;
+}
+
+void ProfilerOverlay::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+  if (!visible) return;
+
+  target.draw(background, states);
+  target.draw(text, states);
+}
@@ -0,0 +1,44 @@
+/*! \brief Draws the profiler's rolling zone percentiles on top of the screen
+ *
+ * Shows per-frame milliseconds spent in each zone over the last Profiler::WINDOW frames.
+ * The text is rebuilt a few times a second instead of every frame to keep it cheap.
+ */
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+
+#include "bnProfiler.h"
+
+class ProfilerOverlay : public sf::Drawable {
+public:
+  /**
+   * @brief Creates a hidden overlay
+   * @param font font to print zones with
+   */
+  ProfilerOverlay(const std::shared_ptr<sf::Font>& font);
+  ~ProfilerOverlay();
+
+  /**
+   * @brief Rebuilds the text every REFRESH_FRAMES calls if visible
+   */
+  void Update();
+
+  void Toggle();
+  const bool IsVisible() const;
+
+  /**
+   * @brief Draws the zone table if visible
+   */
+  virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+private:
+  static constexpr unsigned REFRESH_FRAMES = 15;
+  static constexpr unsigned MAX_ROWS = 20;
+
+  std::shared_ptr<sf::Font> font;
+  sf::Text text;
+  sf::RectangleShape background;
+  unsigned frames;
+  bool visible;
+};
@@ -22,7 +22,7 @@ void ProgsManMoveState::OnUpdate(float _elapsed, ProgsMan& progs) {
   Battle::Tile* temp = progs.GetTile();
   Battle::Tile* next = nullptr;
 
-  int random = rand() % 50;
+  int random = progs.GetField()->GetRandom().Next(50);
 
   // Always punch obstacles
   Battle::Tile* tile = progs.GetField()->GetAt(progs.GetTile()->GetX() - 1, progs.GetTile()->GetY());
@@ -40,7 +40,7 @@ void ProgsManMoveState::OnUpdate(float _elapsed, ProgsMan& progs) {
           progs.ChangeState<ProgsManPunchState>();
           return;
         }
-        else if (rand() % 50 > 30) {
+        else if (progs.GetField()->GetRandom().Next(50) > 30) {
           // Throw bombs.
           progs.ChangeState<ProgsManThrowState>();
           return;
@@ -51,7 +51,7 @@ void ProgsManMoveState::OnUpdate(float _elapsed, ProgsMan& progs) {
           return;
         }
       }
-      else if (rand() % 50 > 20) {
+      else if (progs.GetField()->GetRandom().Next(50) > 20) {
         // Throw bombs.
         progs.ChangeState<ProgsManThrowState>();
         return;
@@ -73,7 +73,7 @@ void ProgsManMoveState::OnUpdate(float _elapsed, ProgsMan& progs) {
   }
 
   // otherwise aimlessly move around 
-  int randDirection = rand() % 4;
+  int randDirection = progs.GetField()->GetRandom().Next(4);
 
   if (nextDirection == Direction::NONE) {
     nextDirection = static_cast<Direction>(randDirection + 1);
@@ -17,7 +17,7 @@ ProtoManSummon::ProtoManSummon(ChipSummonHandler* _summons) : Spell(_summons->Ge
 {
   summons = _summons;
   SetPassthrough(true);
-  random = rand() % 20 - 20;
+  random = GetField()->GetRandom().Next(20) - 20;
 
   int lr = (team == Team::RED) ? 1 : -1;
   setScale(2.0f*lr, 2.0f);
@@ -28,36 +28,45 @@ ProtoManSummon::ProtoManSummon(ChipSummonHandler* _summons) : Spell(_summons->Ge
 
   AUDIO.Play(AudioType::APPEAR);
 
-  setTexture(*TEXTURES.LoadTextureFromFile("resources/spells/protoman_summon.png"), true);
+  setTexture(TEXTURES.LoadTextureFromFile("resources/spells/protoman_summon.png"), true);
 
   animationComponent = new AnimationComponent(this);
   this->RegisterComponent(animationComponent);
   animationComponent->Setup(RESOURCE_PATH);
   animationComponent->Load();
 
-  Battle::Tile* next = nullptr;
+  // Only tiles with characters on them can be targets, look them up through the field's character bucket
+  auto characters = field->FindCharacters([this](Character* c) {
+    return c->GetTile() && c->GetTile()->GetTeam() != this->GetTeam();
+  });
+
+  std::vector<Battle::Tile*> candidates;
+
+  for (auto c : characters) {
+    candidates.push_back(c->GetTile());
+  }
 
-  auto allTiles = field->FindTiles([](Battle::Tile* tile) { return true; });
-  auto iter = allTiles.begin();
+  // Visit tiles row by row, left to right, and only once
+  std::sort(candidates.begin(), candidates.end(), [](Battle::Tile* a, Battle::Tile* b) {
+    return a->GetY() < b->GetY() || (a->GetY() == b->GetY() && a->GetX() < b->GetX());
+  });
 
-  while (iter != allTiles.end()) {
-    next = (*iter);
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
 
-	  if (next->ContainsEntityType<Character>() && !next->ContainsEntityType<Obstacle>() && next->GetTeam() != this->GetTeam()) {
-		Battle::Tile* prev = field->GetAt(next->GetX() - 1, next->GetY());
+  for (auto next : candidates) {
+    if (next->ContainsEntityType<Obstacle>()) continue;
 
-		auto characters = prev->FindEntities([_summons](Entity* in) {
-			return _summons->GetCaller() != in && (dynamic_cast<Character*>(in)  && in->GetTeam() != Team::UNKNOWN);
-		});
+    Battle::Tile* prev = field->GetAt(next->GetX() - 1, next->GetY());
 
-	    bool blocked = (characters.size() > 0) || !prev->IsWalkable();
+    auto blockers = prev->FindEntities([_summons](Entity* in) {
+      return _summons->GetCaller() != in && (in->IsA<Character>() && in->GetTeam() != Team::UNKNOWN);
+    });
 
-	    if(!blocked) {
-			targets.push_back(next);
-	    }
-	  }
+    bool blocked = (blockers.size() > 0) || !prev->IsWalkable();
 
-    iter++;
+    if (!blocked) {
+      targets.push_back(next);
+    }
   }
 
   // TODO: noodely callbacks desgin might be best abstracted by ActionLists
@@ -91,8 +100,8 @@ void ProtoManSummon::DoAttackStep() {
 	});
 
 	this->animationComponent->AddCallback(4,  [this]() {
-    for (auto entity : this->targets[0]->FindEntities([](Entity* e) { return dynamic_cast<Character*>(e); })) {
-      Attack(dynamic_cast<Character*>(entity));
+    for (auto entity : this->targets[0]->FindEntities([](Entity* e) { return e->IsA<Character>(); })) {
+      Attack(entity->As<Character>());
     }
 
 		this->targets.erase(targets.begin());
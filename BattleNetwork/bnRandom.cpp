@@ -0,0 +1,111 @@
+#include "bnRandom.h"
+
+#include <atomic>
+#include <chrono>
+#include <random>
+
+namespace {
+  inline uint32_t Rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+  }
+
+  // Expands a 64 bit seed into well mixed state words
+  inline uint64_t SplitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+}
+
+Random::Random() {
+  Seed(MakeSeed());
+}
+
+Random::Random(uint64_t seed) {
+  Seed(seed);
+}
+
+void Random::Seed(uint64_t seed) {
+  this->seed = seed;
+
+  uint64_t x = seed;
+  uint64_t a = SplitMix64(x);
+  uint64_t b = SplitMix64(x);
+
+  state[0] = (uint32_t)a;
+  state[1] = (uint32_t)(a >> 32);
+  state[2] = (uint32_t)b;
+  state[3] = (uint32_t)(b >> 32);
+
+  // xoshiro must never be all zero
+  if ((state[0] | state[1] | state[2] | state[3]) == 0) {
+    state[0] = 1;
+  }
+}
+
+const uint64_t Random::GetSeed() const {
+  return seed;
+}
+
+Random::result_type Random::operator()() {
+  const uint32_t result = Rotl(state[1] * 5, 7) * 9;
+  const uint32_t t = state[1] << 9;
+
+  state[2] ^= state[0];
+  state[3] ^= state[1];
+  state[1] ^= state[2];
+  state[0] ^= state[3];
+
+  state[2] ^= t;
+  state[3] = Rotl(state[3], 11);
+
+  return result;
+}
+
+int Random::Next(int n) {
+  if (n <= 0) return 0;
+
+  // Multiply-shift instead of modulo. Bias is negligible for the small ranges games use.
+  return (int)(((uint64_t)(*this)() * (uint64_t)n) >> 32);
+}
+
+float Random::NextFloat() {
+  // 24 bits fit exactly in a float mantissa
+  return (float)((*this)() >> 8) * (1.0f / 16777216.0f);
+}
+
+Random Random::Split() {
+  uint64_t a = (*this)();
+  uint64_t b = (*this)();
+
+  return Random((a << 32) | b);
+}
+
+namespace {
+  std::atomic<bool> hasSessionSeed{ false };
+  std::atomic<uint64_t> sessionSeed{ 0 };
+}
+
+void Random::SetSessionSeed(uint64_t seed) {
+  sessionSeed = seed;
+  hasSessionSeed = true;
+}
+
+uint64_t Random::MakeSeed() {
+  static std::atomic<uint64_t> counter{ 0 };
+
+  if (hasSessionSeed) {
+    uint64_t x = sessionSeed.fetch_add(0x9E3779B97F4A7C15ULL);
+    return SplitMix64(x);
+  }
+
+  std::random_device device;
+  uint64_t seed = ((uint64_t)device() << 32) | device();
+
+  // random_device may be deterministic on some platforms. Mix in the clock and a counter.
+  seed ^= (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+  seed += counter.fetch_add(1) * 0x9E3779B97F4A7C15ULL;
+
+  return seed;
+}
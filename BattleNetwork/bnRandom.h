@@ -0,0 +1,81 @@
+/*! \file bnRandom.h */
+
+/*! \brief Small seeded pseudo random number generator (xoshiro128**)
+ *
+ * Replaces the global C rand(). Every battle field owns one so a battle
+ * can be replayed from its seed and separate battles can run on separate
+ * threads without sharing generator state. Presentation code that should not
+ * disturb the battle sequence (camera shake, menus, overworld) owns its own.
+ *
+ * Satisfies UniformRandomBitGenerator so it can be handed to std::shuffle.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+class Random {
+public:
+  typedef uint32_t result_type;
+
+  /**
+   * @brief Seeds from Random::MakeSeed()
+   */
+  Random();
+
+  /**
+   * @brief Seeds with a known value. The same seed gives the same sequence on every platform.
+   */
+  explicit Random(uint64_t seed);
+
+  /**
+   * @brief Restarts the sequence from seed
+   */
+  void Seed(uint64_t seed);
+
+  const uint64_t GetSeed() const;
+
+  /**
+   * @brief Next 32 random bits
+   */
+  result_type operator()();
+
+  /**
+   * @brief Uniform integer in [0, n)
+   * @param n upper bound. Returns 0 if n <= 0
+   */
+  int Next(int n);
+
+  /**
+   * @brief Uniform float in [0, 1)
+   */
+  float NextFloat();
+
+  /**
+   * @brief Creates an independent generator seeded from this one
+   *
+   * Used to hand a subsystem its own stream without reseeding from the clock
+   */
+  Random Split();
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return UINT32_MAX; }
+
+  /**
+   * @brief Non deterministic seed for when reproducibility is not needed
+   *
+   * After SetSessionSeed() the seeds come from a fixed sequence instead
+   */
+  static uint64_t MakeSeed();
+
+  /**
+   * @brief Makes every following MakeSeed() call deterministic
+   *
+   * Input recordings store this so a replayed session builds the same battles
+   */
+  static void SetSessionSeed(uint64_t seed);
+
+private:
+  uint64_t seed;
+  uint32_t state[4];
+};
@@ -0,0 +1,116 @@
+#include "bnRenderTargetPool.h"
+#include "bnEngine.h"
+#include "bnLogger.h"
+
+#include <string>
+#include <utility>
+
+RenderTargetPool::RenderTargetPool() {
+}
+
+RenderTargetPool::~RenderTargetPool() {
+  for (auto& entry : entries) {
+    delete entry.target;
+  }
+
+  entries.clear();
+}
+
+sf::RenderTexture* RenderTargetPool::Acquire(const sf::Vector2u& size) {
+  Entry* spare = nullptr;
+
+  for (auto& entry : entries) {
+    if (entry.inUse) continue;
+
+    if (entry.size == size) {
+      entry.inUse = true;
+      entry.target->setView(entry.target->getDefaultView());
+      entry.target->clear(sf::Color::Transparent);
+      return entry.target;
+    }
+
+    if (!spare) {
+      spare = &entry;
+    }
+  }
+
+  if (!spare) {
+    entries.push_back(Entry{ new sf::RenderTexture(), sf::Vector2u(), false });
+    spare = &entries.back();
+  }
+
+  if (!spare->target->create(size.x, size.y)) {
+    Logger::Log("Could not create a pooled render target of size " + std::to_string(size.x) + "x" + std::to_string(size.y));
+  }
+
+  spare->size = size;
+  spare->inUse = true;
+  spare->target->clear(sf::Color::Transparent);
+
+  return spare->target;
+}
+
+void RenderTargetPool::Release(sf::RenderTexture* target) {
+  if (!target) return;
+
+  for (auto& entry : entries) {
+    if (entry.target == target) {
+      entry.inUse = false;
+      return;
+    }
+  }
+}
+
+const size_t RenderTargetPool::GetCount() const {
+  return entries.size();
+}
+
+const size_t RenderTargetPool::GetInUseCount() const {
+  size_t count = 0;
+
+  for (auto& entry : entries) {
+    if (entry.inUse) count++;
+  }
+
+  return count;
+}
+
+PingPongTarget::PingPongTarget() : front(nullptr), back(nullptr) {
+}
+
+PingPongTarget::~PingPongTarget() {
+  Release();
+}
+
+void PingPongTarget::Acquire(const sf::Vector2u& size) {
+  if (IsAcquired() && front->getSize() == size) return;
+
+  Release();
+
+  front = ENGINE.AcquireRenderTarget(size);
+  back = ENGINE.AcquireRenderTarget(size);
+}
+
+void PingPongTarget::Release() {
+  ENGINE.ReleaseRenderTarget(front);
+  ENGINE.ReleaseRenderTarget(back);
+
+  front = back = nullptr;
+}
+
+const bool PingPongTarget::IsAcquired() const {
+  return front != nullptr;
+}
+
+sf::RenderTexture& PingPongTarget::GetFront() {
+  return *front;
+}
+
+sf::RenderTexture& PingPongTarget::GetBack() {
+  return *back;
+}
+
+void PingPongTarget::Swap() {
+  back->display();
+  std::swap(front, back);
+}
@@ -0,0 +1,121 @@
+/*! \file bnRenderTargetPool.h */
+
+/*! \brief Screen sized render targets that are borrowed and returned instead of allocated
+ *
+ * Segues and post effects used to copy the whole surface into a new sf::Texture
+ * every frame. That is a full screen GPU copy plus a texture allocation each time.
+ * Drawing straight into a pooled sf::RenderTexture skips both: targets are created
+ * once and handed out again once returned.
+ *
+ * Targets are only deleted with the pool, but a returned target may be recreated
+ * at another size by a later Acquire(). Nothing may keep drawing to or sampling
+ * a target after returning it. Engine::ReleaseRenderTarget() stops the engine
+ * from drawing to a target that was its render surface.
+ */
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+class RenderTargetPool {
+public:
+  RenderTargetPool();
+
+  /**
+   * @brief Deletes every target, including ones not returned
+   */
+  ~RenderTargetPool();
+
+  RenderTargetPool(const RenderTargetPool&) = delete;
+  RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+  /**
+   * @brief Borrow a target of the given size, cleared to transparent, with its default view
+   * @param size in pixels
+   * @return sf::RenderTexture* give it back with Release()
+   *
+   * A free target of another size is recreated rather than adding a new one,
+   * so resizing the window does not grow the pool.
+   */
+  sf::RenderTexture* Acquire(const sf::Vector2u& size);
+
+  /**
+   * @brief Return a target to the pool. Targets not from this pool are ignored.
+   */
+  void Release(sf::RenderTexture* target);
+
+  /**
+   * @brief Number of targets created so far
+   */
+  const size_t GetCount() const;
+
+  /**
+   * @brief Number of targets currently borrowed
+   */
+  const size_t GetInUseCount() const;
+
+private:
+  struct Entry {
+    sf::RenderTexture* target;
+    sf::Vector2u size;
+    bool inUse;
+  };
+
+  std::vector<Entry> entries;
+};
+
+/**
+ * @class PingPongTarget
+ * @brief Two pooled targets for effects that take more than one pass
+ *
+ * Each pass reads GetFront() and draws into GetBack(), then calls Swap()
+ * so the result becomes the front for the next pass.
+ */
+class PingPongTarget {
+public:
+  PingPongTarget();
+
+  /**
+   * @brief Returns both targets to the engine's pool
+   */
+  ~PingPongTarget();
+
+  PingPongTarget(const PingPongTarget&) = delete;
+  PingPongTarget& operator=(const PingPongTarget&) = delete;
+
+  /**
+   * @brief Borrow both targets from the engine's pool. Does nothing if they already have this size.
+   * @param size in pixels
+   */
+  void Acquire(const sf::Vector2u& size);
+
+  /**
+   * @brief Return both targets to the engine's pool
+   */
+  void Release();
+
+  /**
+   * @brief Query if the targets are borrowed
+   */
+  const bool IsAcquired() const;
+
+  /**
+   * @brief The result of the last pass
+   */
+  sf::RenderTexture& GetFront();
+
+  /**
+   * @brief Where the next pass draws
+   */
+  sf::RenderTexture& GetBack();
+
+  /**
+   * @brief Displays the back target and makes it the front
+   */
+  void Swap();
+
+private:
+  sf::RenderTexture* front;
+  sf::RenderTexture* back;
+};
@@ -18,7 +18,7 @@ RollHeal::RollHeal(ChipSummonHandler* _summons, int _heal) : Spell(_summons->Get
   summons = _summons;
   SetPassthrough(true);
 
-  random = rand() % 20 - 20;
+  random = GetField()->GetRandom().Next(20) - 20;
 
   heal = _heal;
 
@@ -31,7 +31,7 @@ RollHeal::RollHeal(ChipSummonHandler* _summons, int _heal) : Spell(_summons->Get
 
   AUDIO.Play(AudioType::APPEAR);
 
-  setTexture(*TEXTURES.LoadTextureFromFile("resources/spells/spell_roll.png"), true);
+  setTexture(TEXTURES.LoadTextureFromFile("resources/spells/spell_roll.png"), true);
 
   animationComponent = new AnimationComponent(this);
   this->RegisterComponent(animationComponent);
@@ -133,10 +133,10 @@ void RollHeal::Attack(Character* _entity) {
 
       int i = 1;
 
-      if (rand() % 2 == 0) i = -1;
+      if (GetField()->GetRandom().Next(2) == 0) i = -1;
 
       if (_entity) {
-        _entity->setPosition(_entity->getPosition().x + (i*(rand() % 4)), _entity->getPosition().y + (i*(rand() % 4)));
+        _entity->setPosition(_entity->getPosition().x + (i*GetField()->GetRandom().Next(4)), _entity->getPosition().y + (i*GetField()->GetRandom().Next(4)));
       }
 
       AUDIO.Play(AudioType::HURT);
@@ -1,17 +1,55 @@
 #include "bnSceneNode.h"
+#include "bnSpriteBatch.h"
 
 SceneNode::SceneNode() {
+  parent = nullptr;
   show = true;
   layer = 0;
   useParentShader = false;
+  drawListDirty = true;
 }
 
 SceneNode::~SceneNode() {
+  for (auto child : childNodes) {
+    if (child->parent == this) {
+      child->parent = nullptr;
+    }
+  }
 
+  if (parent) {
+    parent->RemoveNode(this);
+  }
 }
 
 void SceneNode::SetLayer(int layer) {
+  if (this->layer == layer) return;
+
   this->layer = layer;
+
+  if (parent) {
+    auto& siblings = parent->childNodes;
+    auto iter = std::find(siblings.begin(), siblings.end(), this);
+
+    if (iter != siblings.end()) {
+      siblings.erase(iter);
+      parent->InsertChild(this);
+    }
+  }
+
+  // Our own children may now draw on the other side of us
+  InvalidateDrawList();
+}
+
+void SceneNode::InvalidateDrawList() {
+  for (SceneNode* node = this; node; node = node->parent) {
+    node->drawListDirty = true;
+  }
+}
+
+void SceneNode::InsertChild(SceneNode* child) {
+  auto iter = std::upper_bound(childNodes.begin(), childNodes.end(), child->layer, [](int layer, SceneNode* in) { return layer > in->layer; });
+
+  childNodes.insert(iter, child);
 }
 
 const int SceneNode::GetLayer() const {
@@ -37,22 +75,29 @@ const bool SceneNode::IsVisible() const {
 void SceneNode::draw(sf::RenderTarget& target, sf::RenderStates states) const {
   if (!show) return;
 
-  std::sort(childNodes.begin(), childNodes.end(), [](SceneNode* a, SceneNode* b) { return (a->GetLayer() > b->GetLayer()); });
+  sf::RenderStates unshaded = states;
+  unshaded.shader = nullptr;
 
   // draw its children
   for (std::size_t i = 0; i < childNodes.size(); i++) {
-    auto childStates = states;
+    childNodes[i]->draw(target, childNodes[i]->useParentShader ? states : unshaded);
+  }
+}
 
-    if (!childNodes[i]->useParentShader) {
-      childStates.shader = nullptr;
-    }
+void SceneNode::DrawBatched(SpriteBatch& batch, sf::RenderStates states) const {
+  if (!show) return;
 
-    childNodes[i]->draw(target, childStates);
-  }
+  // We do not know what this node draws. Keep the draw order by emptying the batch first.
+  batch.Flush();
+  draw(*batch.GetTarget(), states);
 }
 
 void SceneNode::AddNode(SceneNode* child) { 
-  if (child == nullptr) return;  child->parent = this; childNodes.push_back(child); 
+  if (child == nullptr) return;
+
+  child->parent = this;
+  InsertChild(child);
+  InvalidateDrawList();
 }
 
 void SceneNode::RemoveNode(SceneNode* find) {
@@ -60,7 +105,15 @@ void SceneNode::RemoveNode(SceneNode* find) {
 
   auto iter = std::remove_if(childNodes.begin(), childNodes.end(), [find](SceneNode *in) { return in == find; }); 
 
+  if (iter == childNodes.end()) return;
+
   childNodes.erase(iter, childNodes.end());
+
+  if (find->parent == this) {
+    find->parent = nullptr;
+  }
+
+  InvalidateDrawList();
 }
 
 void SceneNode::EnableParentShader(bool use)
@@ -73,7 +126,7 @@ const bool SceneNode::IsUsingParentShader() const
   return useParentShader;
 }
 
-std::vector<SceneNode*>& SceneNode::GetChildNodes()
+const std::vector<SceneNode*>& SceneNode::GetChildNodes() const
 {
   return childNodes;
 }
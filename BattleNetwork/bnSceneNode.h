@@ -3,6 +3,9 @@
  * 
  * Nodes attached are not handled by the parent node.
  * Do not expect the deletion of this node to free the memory.
+ * 
+ * Children are kept in draw order (highest layer first) as they are added and
+ * when their layer changes, so drawing never sorts.
  * */
 
 #pragma once
@@ -10,13 +13,27 @@
 #include <algorithm>
 #include <SFML/Graphics.hpp>
 
+class SpriteBatch;
+
 class SceneNode : public sf::Transformable, public sf::Drawable {
 protected:
-  mutable std::vector<SceneNode*> childNodes; /*!< List of all children */
+  std::vector<SceneNode*> childNodes; /*!< List of all children, sorted by descending layer */
   SceneNode* parent; /*!< The node this node is a child of */
   bool show; /*!< Flag to hide or display a scene node and its children */
   int layer; /*!< Draw order of this node */
   bool useParentShader;
+  mutable bool drawListDirty; /*!< The children or a layer in this subtree changed since the last draw */
+
+  /**
+   * @brief Flags this node and every ancestor so cached draw lists are rebuilt
+   */
+  void InvalidateDrawList();
+
+private:
+  /**
+   * @brief Inserts after every child on the same layer so equal layers keep insertion order
+   */
+  void InsertChild(SceneNode* child);
 
 public:
   /**
@@ -27,12 +44,12 @@ public:
   SceneNode(const SceneNode& rhs) = delete;
 
   /**
-   * @brief Deconstructor does not delete children
+   * @brief Deconstructor does not delete children. Detaches from the parent and the children.
    */
   virtual ~SceneNode();
   
   /**
-   * @brief Sets the layer
+   * @brief Sets the layer and moves this node to its new place among its siblings
    * @param layer
    */
   void SetLayer(int layer);
@@ -66,12 +83,21 @@ public:
   const bool IsVisible() const;
 
   /**
-   * @brief Sort the nodes by Ascending Z Order and draw the nodes
+   * @brief Draw the children in layer order
    * @param target
    * @param states
    */
   virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
+  /**
+   * @brief Draw the node through a sprite batch
+   * @param batch
+   * @param states
+   *
+   * Plain scene nodes flush the batch and draw to its target directly
+   */
+  virtual void DrawBatched(SpriteBatch& batch, sf::RenderStates states) const;
+
   /**
    * @brief Adds a child node
    * @param child the node to add
@@ -97,8 +123,10 @@ public:
   const bool IsUsingParentShader() const;
 
   /**
-  * Fetches all the child nodes attached to this node
+  * Fetches all the child nodes attached to this node in draw order
   * @return a reference to the vector of SceneNode*
+  * 
+  * Use AddNode() and RemoveNode() to change the list so it stays ordered
   */
-  std::vector<SceneNode*>& GetChildNodes();
+  const std::vector<SceneNode*>& GetChildNodes() const;
 };
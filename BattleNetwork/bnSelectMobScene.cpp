@@ -81,8 +81,6 @@ SelectMobScene::SelectMobScene(swoosh::ActivityController& controller, SelectedN
 }
 
 SelectMobScene::~SelectMobScene() {
-  delete font;
-  delete mobFont;
   //delete hpFont;
   delete mobLabel;
   delete attackLabel;
@@ -99,11 +97,14 @@ void SelectMobScene::onResume() {
 	  mob = nullptr;
   }
 
+  // Release textures only the finished battle was using so VRAM stays flat across battles
+  TEXTURES.EvictUnused();
+
   // Fix camera if offset from battle
   ENGINE.SetCamera(camera);
 
-  // Re-play music
-  AUDIO.Stream("resources/loops/loop_navi_customizer.ogg", true);
+  // Re-play music. Fade in over whatever the battle left playing.
+  AUDIO.CrossfadeStream("resources/loops/loop_navi_customizer.ogg", 1.0f, true);
 
   gotoNextScene = false;
   doOnce = true;
@@ -295,7 +296,7 @@ void SelectMobScene::onUpdate(double elapsed) {
       }
       else {
         if (mobLabel->getString()[i] != ' ') {
-          newstr += (char)(((rand() % (90 - 65)) + 65) + 1);
+          newstr += (char)((random.Next(90 - 65) + 65) + 1);
         }
         else {
           newstr += ' ';
@@ -310,7 +311,7 @@ void SelectMobScene::onUpdate(double elapsed) {
     int count = (int)mobinfo.GetHPString().size() - 1;
     while (count >= 0) {
       int index = (int)std::pow(10.0, (double)count);
-      index *= (rand() % 9) + 1;
+      index *= random.Next(9) + 1;
 
       randHP += index;
 
@@ -321,7 +322,7 @@ void SelectMobScene::onUpdate(double elapsed) {
 
     while (count >= 0) {
       int index = (int)std::pow(10.0, (double)count);
-      index *= (rand() % 9) + 1;
+      index *= random.Next(9) + 1;
 
       randAttack += index;
 
@@ -332,7 +333,7 @@ void SelectMobScene::onUpdate(double elapsed) {
 
     while (count >= 0) {
       int index = (int)std::pow(10.0, (double)count);
-      index *= (rand() % 9) + 1;
+      index *= random.Next(9) + 1;
 
       randSpeed += index;
 
@@ -394,11 +395,14 @@ void SelectMobScene::onUpdate(double elapsed) {
       // Stop music and go to battle screen 
       AUDIO.StopStream();
 
+      // Have the menu music ready for when the battle is over
+      AUDIO.PrefetchStream("resources/loops/loop_navi_customizer.ogg");
+
       // Get the navi we selected
       Player* player = NAVIS.At(selectedNavi).GetNavi();
 
-      // Shuffle our folder
-      selectedFolder.Shuffle();
+      // Shuffle our folder with the battle's generator so the draw order replays from its seed
+      selectedFolder.Shuffle(mob->GetField()->GetRandom());
 
       // Queue screen transition to Battle Scene with a white fade effect
       // just like the game
@@ -464,11 +468,18 @@ void SelectMobScene::onDraw(sf::RenderTexture & surface) {
   if (mobSpr.getTexture()) {
     sf::IntRect t = mobSpr.getTextureRect();
     sf::Vector2u size = mobSpr.getTexture()->getSize();
-    shader.SetUniform("x", (float)t.left / (float)size.x);
-    shader.SetUniform("y", (float)t.top / (float)size.y);
-    shader.SetUniform("w", (float)t.width / (float)size.x);
-    shader.SetUniform("h", (float)t.height / (float)size.y);
-    shader.SetUniform("pixel_threshold", (float)(factor / 400.f));
+    // Resolved once, these run every frame
+    static const SmartShader::UniformSlot xSlot = SmartShader::GetUniformSlot("x");
+    static const SmartShader::UniformSlot ySlot = SmartShader::GetUniformSlot("y");
+    static const SmartShader::UniformSlot wSlot = SmartShader::GetUniformSlot("w");
+    static const SmartShader::UniformSlot hSlot = SmartShader::GetUniformSlot("h");
+    static const SmartShader::UniformSlot thresholdSlot = SmartShader::GetUniformSlot("pixel_threshold");
+
+    shader.SetUniform(xSlot, (float)t.left / (float)size.x);
+    shader.SetUniform(ySlot, (float)t.top / (float)size.y);
+    shader.SetUniform(wSlot, (float)t.width / (float)size.x);
+    shader.SetUniform(hSlot, (float)t.height / (float)size.y);
+    shader.SetUniform(thresholdSlot, (float)(factor / 400.f));
 
     // Refresh mob graphic origin every frame as it may change
     mobSpr.setOrigin(mobSpr.getTextureRect().width / 2.f, mobSpr.getTextureRect().height / 2.f);
@@ -132,8 +132,6 @@ SelectNaviScene::SelectNaviScene(swoosh::ActivityController& controller, Selecte
 
 SelectNaviScene::~SelectNaviScene()
 {
-  delete font;
-  delete naviFont;
   delete naviLabel;
   delete attackLabel;
   delete speedLabel;
@@ -371,7 +369,7 @@ void SelectNaviScene::onUpdate(double elapsed) {
         if (naviLabel->getString()[i] != ' ') {
             
           // Choose a random, capital ASCII character
-          newstr += (char)(((rand() % (90 - 65)) + 65) + 1);
+          newstr += (char)((random.Next(90 - 65) + 65) + 1);
         }
         else {
           newstr += ' ';
@@ -379,8 +377,8 @@ void SelectNaviScene::onUpdate(double elapsed) {
       }
     }
 
-    int randAttack = rand() % 10;
-    int randSpeed = rand() % 10;
+    int randAttack = random.Next(10);
+    int randSpeed = random.Next(10);
 
     //attackLabel->setString(std::to_string(randAttack));
     //speedLabel->setString(std::to_string(randSpeed));
@@ -408,11 +406,18 @@ void SelectNaviScene::onUpdate(double elapsed) {
 
   sf::IntRect t = navi.getTextureRect();
   sf::Vector2u size = navi.getTexture()->getSize();
-  pixelated.SetUniform("x", (float)t.left / (float)size.x);
-  pixelated.SetUniform("y", (float)t.top / (float)size.y);
-  pixelated.SetUniform("w", (float)t.width / (float)size.x);
-  pixelated.SetUniform("h", (float)t.height / (float)size.y);
-  pixelated.SetUniform("pixel_threshold", (float)(factor / 400.f));
+  // Resolved once, these run every frame
+  static const SmartShader::UniformSlot xSlot = SmartShader::GetUniformSlot("x");
+  static const SmartShader::UniformSlot ySlot = SmartShader::GetUniformSlot("y");
+  static const SmartShader::UniformSlot wSlot = SmartShader::GetUniformSlot("w");
+  static const SmartShader::UniformSlot hSlot = SmartShader::GetUniformSlot("h");
+  static const SmartShader::UniformSlot thresholdSlot = SmartShader::GetUniformSlot("pixel_threshold");
+
+  pixelated.SetUniform(xSlot, (float)t.left / (float)size.x);
+  pixelated.SetUniform(ySlot, (float)t.top / (float)size.y);
+  pixelated.SetUniform(wSlot, (float)t.width / (float)size.x);
+  pixelated.SetUniform(hSlot, (float)t.height / (float)size.y);
+  pixelated.SetUniform(thresholdSlot, (float)(factor / 400.f));
 
   // Refresh mob graphic origin every frame as it may change
   float xpos = ((glowbase.getTextureRect().width / 2.0f)*glowbase.getScale().x) + glowbase.getPosition().x;
@@ -52,8 +52,8 @@ private:
   double selectInputCooldown;    /*!< count down before registering input */
 
   // NAVI UI font
-  sf::Font* font;
-  sf::Font *naviFont;
+  std::shared_ptr<sf::Font> font;
+  std::shared_ptr<sf::Font> naviFont;
   sf::Text* menuLabel;
 
   sf::Text *naviLabel; /*!< navi name text */
@@ -63,6 +63,7 @@ private:
 
   float maxNumberCooldown; /*!< half a second scramble effect */
   float numberCooldown; /*!< Effect count down */
+  Random random; /*!< Scrambled label characters */
 
   Background* bg; /*!< background graphics */
 
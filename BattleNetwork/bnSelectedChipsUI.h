@@ -6,6 +6,7 @@
 #include <SFML/Graphics.hpp>
 #include <sstream>
 #include <vector>
+#include <memory>
 #include "bnUIComponent.h"
 #include "bnChipUsePublisher.h"
 
@@ -70,7 +71,7 @@ private:
   mutable bool firstFrame; /*!< If true, this UI graphic is being drawn for the first time*/
   sf::Time interpolDur; /*!< Max duration for interpolation 0.2 seconds */
   Player* player; /*!< Player this component is attached to */
-  Font* font; /*!< Chip name font */
+  std::shared_ptr<sf::Font> font; /*!< Chip name font */
   mutable Text text; /*!< Text displays chip name */
   mutable Text dmg; /*!< Text displays chip damage */
   mutable sf::Sprite icon, frame; /*!< Sprite for the chip icon and the black border */
@@ -1,5 +1,8 @@
 #include "bnShaderResourceManager.h"
 #include "bnShaderType.h"
+#include "bnAssetPack.h"
+#include "bnFileUtil.h"
+#include "bnProfiler.h"
 #include <stdlib.h>
 #include <sstream>
 using std::stringstream;
@@ -12,6 +15,8 @@ ShaderResourceManager& ShaderResourceManager::GetInstance() {
 }
 
 void ShaderResourceManager::LoadAllShaders(std::atomic<int> &status) {
+    PROFILE_ZONE("Shaders::LoadAllShaders");
+
     ShaderType shaderType = static_cast<ShaderType>(0);
     while (shaderType != ShaderType::SHADER_TYPE_SIZE)
     {
@@ -28,36 +33,50 @@ void ShaderResourceManager::LoadAllShaders(std::atomic<int> &status) {
 
 }
 
+/**
+ * @brief Reads shader source from the asset pack or from disk if the pack is stale
+ */
+static string ReadShaderSource(const string& _path) {
+  if (const AssetPack::Entry* entry = ASSETPACK.Find(_path, AssetPack::EntryKind::blob)) {
+    return string(ASSETPACK.GetBlob(*entry));
+  }
+
+  return FileUtil::Read(_path);
+}
+
 sf::Shader* ShaderResourceManager::LoadShaderFromFile(string _path)
 {
-#ifdef __ANDROID__
+#if BN_HEADLESS
+    // Nothing is drawn so nothing is compiled. Unloaded shaders ignore uniforms.
+    // The object is still a GL resource: SFML opens its shared context on the first one.
+    sf::Shader* shader = new sf::Shader();
+#elif defined(__ANDROID__)
     sf::Shader* shader = new sf::Shader();
     bool result = false;
 
-    if(shader->loadFromFile(_path + ".vert", _path + ".frag"))
+    string vert = ReadShaderSource(_path + ".vert");
+    string frag = ReadShaderSource(_path + ".frag");
+
+    if(!vert.empty() && shader->loadFromMemory(vert, frag))
     {
         result = true;
     }
     else // default vert shader
     {
-        result = shader->loadFromFile(paths[static_cast<int>(ShaderType::DEFAULT)] + ".vert", _path + ".frag");
+        result = shader->loadFromMemory(ReadShaderSource(paths[static_cast<int>(ShaderType::DEFAULT)] + ".vert"), frag);
     }
 
     if (!result)
     {
-        Logger::GetMutex()->lock();
-        Logger::Log("Error loading shader: " + _path);
-        Logger::GetMutex()->unlock();
+        Logger::Log(LogLevel::Error, LogCategory::Resources, "Error loading shader: " + _path);
 
         return nullptr;
     }
 #else 
     sf::Shader* shader = new sf::Shader();
-    if (!shader->loadFromFile(_path + ".frag", sf::Shader::Fragment)) {
+    if (!shader->loadFromMemory(ReadShaderSource(_path + ".frag"), sf::Shader::Fragment)) {
 
-      Logger::GetMutex()->lock();
-      Logger::Log("Error loading shader: " + _path + ".frag");
-      Logger::GetMutex()->unlock();
+      Logger::Log(LogLevel::Error, LogCategory::Resources, "Error loading shader: " + _path + ".frag");
 
       exit(EXIT_FAILURE);
       return nullptr;
@@ -66,9 +85,7 @@ sf::Shader* ShaderResourceManager::LoadShaderFromFile(string _path)
 
     //shader->setUniform("texture", sf::Shader::CurrentTexture);
 
-    Logger::GetMutex()->lock();
-    Logger::Log("Loaded shader: " + _path);
-    Logger::GetMutex()->unlock();
+    Logger::Log(LogLevel::Info, LogCategory::Resources, "Loaded shader: " + _path);
 
     return shader;
 }
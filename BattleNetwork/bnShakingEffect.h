@@ -1,5 +1,6 @@
 #pragma once
 #include "bnComponent.h"
+#include "bnRandom.h"
 #include <SFML/Graphics.hpp>
 class BattleScene;
 class Entity;
@@ -14,6 +15,7 @@ private:
   bool isShaking;
   float shakeProgress;
   sf::Vector2f startPos;
+  Random random; /*!< Shake angles. Scene effect so it stays off the battle's generator */
 public:
   ShakingEffect(Entity* owner);
   ~ShakingEffect();
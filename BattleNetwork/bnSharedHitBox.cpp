@@ -37,7 +37,7 @@ bool SharedHitbox::Move(Direction _direction) {
 }
 
 const bool SharedHitbox::OnHit(const Hit::Properties props) {
-  Character* c = dynamic_cast<Character*>(owner);
+  Character* c = owner ? owner->As<Character>() : nullptr;
 	
   if(c) {
 	return c->Hit(props); 
@@ -59,6 +59,6 @@ void SharedHitbox::Attack(Character* _entity) {
 }
 
 const float SharedHitbox::GetHeight() const {
-    if(Character* c = dynamic_cast<Character*>(owner)) { return c->GetHeight(); }
+    if(Character* c = owner ? owner->As<Character>() : nullptr) { return c->GetHeight(); }
     else { return 0; }
 }
@@ -1,19 +1,25 @@
 #include "bnSmartShader.h"
 
+#include <unordered_map>
+
+namespace {
+  std::vector<std::string>& UniformNames() {
+    static std::vector<std::string> names;
+    return names;
+  }
+}
+
   SmartShader::SmartShader() {
     ref = nullptr;
   }
 
   SmartShader::SmartShader(const SmartShader& copy) {
-    funiforms = copy.funiforms;
-    iuniforms = copy.iuniforms;
-    vfuniforms = copy.vfuniforms;
+    uniforms = copy.uniforms;
     ref = copy.ref;
   }
 
   SmartShader::~SmartShader() {
-    iuniforms.clear();
-    funiforms.clear();
+    uniforms.clear();
     ref = nullptr;
   }
 
@@ -35,60 +41,176 @@
    return ref;
  }
 
+ const sf::Shader* SmartShader::Get() const {
+   return ref;
+ }
+
+  const bool SmartShader::Uniform::operator==(const Uniform& rhs) const {
+    return slot == rhs.slot && type == rhs.type && ivalue == rhs.ivalue && fvalue == rhs.fvalue;
+  }
+
+  SmartShader::UniformSlot SmartShader::GetUniformSlot(const std::string& uniform) {
+    static std::unordered_map<std::string, UniformSlot> slots;
+
+    auto iter = slots.find(uniform);
+
+    if (iter != slots.end()) {
+      return iter->second;
+    }
+
+    UniformSlot slot = (UniformSlot)UniformNames().size();
+    UniformNames().push_back(uniform);
+    slots.emplace(uniform, slot);
+
+    return slot;
+  }
+
   void SmartShader::ApplyUniforms() {
-    iiter iIter = iuniforms.begin();
-    fiter fIter = funiforms.begin();
-    vfiter vfIter = vfuniforms.begin();
+    if (!ref) return;
+
+    Sync(ref, uniforms);
+  }
+
+  void SmartShader::ApplyDefaults(const sf::Shader* program) {
+    static const std::vector<Uniform> none;
+
+    if (!program) return;
 
-    for (; iIter != iuniforms.end(); iIter++) {
-      ref->setUniform(iIter->first, iIter->second);
+    Sync(const_cast<sf::Shader*>(program), none);
+  }
+
+  void SmartShader::Sync(sf::Shader* program, const std::vector<Uniform>& values) {
+    // What each program was last given. Programs live as long as the shader manager.
+    static std::unordered_map<const sf::Shader*, std::vector<Uniform>> uploaded;
+
+    auto iter = uploaded.find(program);
+
+    if (iter == uploaded.end()) {
+      if (values.empty()) return;
+
+      iter = uploaded.emplace(program, std::vector<Uniform>()).first;
     }
 
-    for (; fIter != funiforms.end(); fIter++) {
-      ref->setUniform(fIter->first, fIter->second);
+    std::vector<Uniform>& current = iter->second;
+    const std::vector<std::string>& names = UniformNames();
+
+    auto upload = [program, &names](const Uniform& u) {
+      const std::string& name = names[u.slot];
+
+      switch (u.type) {
+      case UniformType::Int:
+        program->setUniform(name, u.ivalue);
+        break;
+      case UniformType::Float:
+        program->setUniform(name, u.fvalue.x);
+        break;
+      case UniformType::Vec2f:
+        program->setUniform(name, u.fvalue);
+        break;
+      }
+    };
+
+    // Anything a previous draw set that this one does not goes back to 0
+    for (auto& u : current) {
+      if (u.ivalue == 0 && u.fvalue == sf::Vector2f()) continue;
+
+      bool wanted = false;
+
+      for (auto& v : values) {
+        if (v.slot == u.slot) { wanted = true; break; }
+      }
+
+      if (!wanted) {
+        u.ivalue = 0;
+        u.fvalue = sf::Vector2f();
+        upload(u);
+      }
     }
 
-    for (; vfIter != vfuniforms.end(); vfIter++) {
-      ref->setUniform(vfIter->first, vfIter->second);
+    for (auto& v : values) {
+      bool found = false;
+
+      for (auto& u : current) {
+        if (u.slot != v.slot) continue;
+
+        found = true;
+
+        if (!(u == v)) {
+          u = v;
+          upload(v);
+        }
+
+        break;
+      }
+
+      if (!found) {
+        current.push_back(v);
+        upload(v);
+      }
     }
   }
 
-  void SmartShader::ResetUniforms() {
-    if (!ref) {
-      return;
+  void SmartShader::Set(const Uniform& uniform) {
+    for (auto& u : uniforms) {
+      if (u.slot == uniform.slot) {
+        u = uniform;
+        return;
+      }
     }
 
-    iiter iIter = iuniforms.begin();
-    fiter fIter = funiforms.begin();
-    vfiter vfIter = vfuniforms.begin();
+    uniforms.push_back(uniform);
+  }
 
-    for (; iIter != iuniforms.end(); iIter++) {
-      ref->setUniform(iIter->first, 0);
-    }
+  void SmartShader::SetUniform(UniformSlot slot, float fvalue) {
+    Set(Uniform{ slot, UniformType::Float, 0, sf::Vector2f(fvalue, 0.f) });
+  }
 
-    for (; fIter != funiforms.end(); fIter++) {
-      ref->setUniform(fIter->first, 0.f);
-    }
+  void SmartShader::SetUniform(UniformSlot slot, int ivalue) {
+    Set(Uniform{ slot, UniformType::Int, ivalue, sf::Vector2f() });
+  }
 
-    for (; vfIter != vfuniforms.end(); vfIter++) {
-      ref->setUniform(vfIter->first, 0.f);
-    }
+  void SmartShader::SetUniform(UniformSlot slot, const sf::Vector2f& vfvalue) {
+    Set(Uniform{ slot, UniformType::Vec2f, 0, vfvalue });
+  }
 
-    iuniforms.clear();
-    funiforms.clear();
-    vfuniforms.clear();
+  void SmartShader::SetUniform(const std::string& uniform, float fvalue) {
+    SetUniform(GetUniformSlot(uniform), fvalue);
   }
 
-  void SmartShader::SetUniform(std::string uniform, float fvalue) {
-    funiforms[uniform] = fvalue;
+  void SmartShader::SetUniform(const std::string& uniform, int ivalue) {
+    SetUniform(GetUniformSlot(uniform), ivalue);
   }
 
-  void SmartShader::SetUniform(std::string uniform, int ivalue) {
-    iuniforms[uniform] = ivalue;
+  void SmartShader::SetUniform(const std::string& uniform, const sf::Vector2f& vfvalue) {
+    SetUniform(GetUniformSlot(uniform), vfvalue);
   }
 
-  void SmartShader::SetUniform(std::string uniform, const sf::Vector2f& vfvalue) {
-    vfuniforms[uniform] = vfvalue;
+  const bool SmartShader::HasUniforms() const {
+    return !uniforms.empty();
+  }
+
+  const bool SmartShader::HasSameUniforms(const SmartShader& other) const {
+    return SameUniforms(uniforms, other.uniforms);
+  }
+
+  const bool SmartShader::SameUniforms(const std::vector<Uniform>& a, const std::vector<Uniform>& b) {
+    if (a.size() != b.size()) return false;
+
+    for (auto& u : a) {
+      bool match = false;
+
+      for (auto& v : b) {
+        if (u == v) { match = true; break; }
+      }
+
+      if (!match) return false;
+    }
+
+    return true;
+  }
+
+  void SmartShader::ResetUniforms() {
+    uniforms.clear();
   }
 
   void SmartShader::Reset() {
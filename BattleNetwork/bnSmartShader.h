@@ -1,102 +1,191 @@
 /*! \brief A shader wrapper that intelligently applies itself during draw calls
- * 
- * Currently supports int, float, double, vector2f uniforms
- * 
+ *
+ * Currently supports int, float, vector2f uniforms
+ *
  * Additional uniforms must be added
+ *
+ * Uniform names are resolved once to integer slots with GetUniformSlot().
+ * Values stay set until changed or reset. The last values uploaded to each
+ * shader program are cached, so applying uniforms only uploads what differs from
+ * the program's current state. Uniforms a previous draw set on the same program
+ * but this shader does not are returned to 0, as if every draw started clean.
+ *
+ * Uniforms managed here must not also be set directly on the sf::Shader.
  */
 
 #pragma once
 #include <SFML/Graphics.hpp>
-#include <map>
+#include <string>
+#include <vector>
 
 class SmartShader
 {
   friend class Engine;
+  friend class SpriteBatch;
+  friend class PostProcessGraph;
+
+public:
+  typedef int UniformSlot; /*!< Index of a uniform name. Same name, same slot, for every shader. */
+
 private:
-  sf::Shader* ref; /*!< Pointer to shader object */
-  std::map<std::string, int>    iuniforms; /*!< lookup of integer uniforms */
-  std::map<std::string, float>  funiforms; /*!< lookup of float uniforms */
-  std::map<std::string, double> duniforms; /*!< lookup of double uniforms */
-  std::map<std::string, sf::Vector2f> vfuniforms; /*!< lookup of vector2f uniforms */
+  enum class UniformType : unsigned char {
+    Int,
+    Float,
+    Vec2f
+  };
 
-  typedef std::map<std::string, int>::iterator iiter; 
-  typedef std::map<std::string, float>::iterator fiter;
-  typedef std::map<std::string, sf::Vector2f>::iterator vfiter;
+  struct Uniform {
+    UniformSlot slot;
+    UniformType type;
+    int ivalue;
+    sf::Vector2f fvalue; /*!< x holds float uniforms */
+
+    const bool operator==(const Uniform& rhs) const;
+  };
+
+  sf::Shader* ref; /*!< Pointer to shader object */
+  std::vector<Uniform> uniforms; /*!< At most one entry per slot. Shaders use a handful so a linear search wins. */
 
   /**
-   * @brief Applies all registered uniform values before drawing
+   * @brief Uploads the values that differ from what the program currently holds
    */
   void ApplyUniforms();
-  
+
   /**
-   * @brief Clears the shader object of all uniform values
+   * @brief Returns every uniform set through a SmartShader on the program to 0
+   *
+   * Used by draws that bind the program without a SmartShader
    */
-  void ResetUniforms();
+  static void ApplyDefaults(const sf::Shader* program);
+
+  /**
+   * @brief Brings the program's uniforms to values, uploading only what changed
+   */
+  static void Sync(sf::Shader* program, const std::vector<Uniform>& values);
+
+  /**
+   * @brief Query if both lists hold the same values, in any order
+   */
+  static const bool SameUniforms(const std::vector<Uniform>& a, const std::vector<Uniform>& b);
+
+  void Set(const Uniform& uniform);
 
 public:
   /**
    * @brief Constructs a smart shader with pointer to sf::Shader ref set to nullptr
    */
   SmartShader();
-  
+
   /**
    * @brief Constructs a smart shader from another smart shader
    */
   SmartShader(const SmartShader&);
-  
+
   /**
-   * @brief Frees the reference to the shader object and empties the uniform dictionaries
+   * @brief Frees the reference to the shader object and empties the uniform values
    */
   ~SmartShader();
-  
+
   /**
    * @brief Assigns shader object ref to rhs
    * @param rhs shader object to assign itself to
    */
   SmartShader(const sf::Shader& rhs);
-  
+
+  SmartShader& operator=(const SmartShader& rhs) = default;
+
   /**
    * @brief Assignment ops assigns ref to a shader object rhs
    * @param rhs
    */
   SmartShader& operator=(const sf::Shader& rhs);
-  
+
   /**
    * @brief Assignment ops assigns ref to a shader object rhs
    * @param rhs
    */
   SmartShader& operator=(const sf::Shader* rhs);
-  
+
+  /**
+   * @brief Resolves a uniform name to its slot. Resolve once and keep the slot.
+   * @param uniform the name of the uniform
+   */
+  static UniformSlot GetUniformSlot(const std::string& uniform);
+
+  /**
+   * @brief Set a float uniform value
+   * @param slot from GetUniformSlot()
+   * @param fvalue
+   */
+  void SetUniform(UniformSlot slot, float fvalue);
+
+  /**
+   * @brief Set an integer uniform value
+   * @param slot from GetUniformSlot()
+   * @param ivalue
+   */
+  void SetUniform(UniformSlot slot, int ivalue);
+
+  /**
+   * @brief Set a vector2f uniform value
+   * @param slot from GetUniformSlot()
+   * @param vfvalue
+   */
+  void SetUniform(UniformSlot slot, const sf::Vector2f& vfvalue);
+
   /**
    * @brief Set a float uniform value
    * @param uniform the name of the uniform
    * @param fvalue
    */
-  void SetUniform(std::string uniform, float fvalue);
-  
+  void SetUniform(const std::string& uniform, float fvalue);
+
   /**
    * @brief Set an integer uniform value
    * @param uniform the name of the uniform
    * @param ivalue
    */
-  void SetUniform(std::string uniform, int ivalue);
-  
+  void SetUniform(const std::string& uniform, int ivalue);
+
   /**
    * @brief Set a vector2f uniform values
    * @param uniform the name of the uniform
    * @param vfvalue
    */
-  void SetUniform(std::string uniform, const sf::Vector2f& vfvalue);
-  
+  void SetUniform(const std::string& uniform, const sf::Vector2f& vfvalue);
+
+  /**
+   * @brief Query if any uniform values are registered
+   * @return true if ApplyUniforms() would set anything
+   */
+  const bool HasUniforms() const;
+
+  /**
+   * @brief Query if both shaders would leave the program in the same state
+   *
+   * Draws with the same program and the same uniforms can share a draw call
+   */
+  const bool HasSameUniforms(const SmartShader& other) const;
+
   /**
-   * @brief Sets all pre-existing uniforms to 0, empties the lookups, and frees ref
+   * @brief Empties the uniform values. The program is returned to 0 lazily by the next draw that uses it.
+   */
+  void ResetUniforms();
+
+  /**
+   * @brief Empties the uniform values and frees ref
    */
   void Reset();
-  
+
   /**
    * @brief Fetch the shader object
    * @return sf::Shader*
    */
   sf::Shader* Get();
-};
 
+  /**
+   * @brief Fetch the shader object
+   * @return const sf::Shader*
+   */
+  const sf::Shader* Get() const;
+};
@@ -9,6 +9,7 @@
 
 
 Spell::Spell(Field* field, Team team) : Entity() {
+  Tag<Spell>(this);
   SetFloatShoe(true);
   SetLayer(1);
   SetTeam(team);
@@ -11,6 +11,7 @@
 #include "bnTile.h"
 #include "bnCharacter.h"
 #include "bnAnimationComponent.h"
+#include "bnEntityPool.h"
 
 using sf::Texture;
 
@@ -23,6 +24,12 @@ public:
   Spell(Field* field, Team team);
   virtual ~Spell();
 
+  /**
+   * @brief Spells are created and deleted every frame. Their memory is recycled by EntityPool.
+   */
+  static void* operator new(std::size_t size) { return EntityPool::Allocate(size); }
+  static void operator delete(void* ptr, std::size_t size) { EntityPool::Free(ptr, size); }
+
   /**
    * @brief Queried by Tile to highlight or not
    * @return Highlight mode
@@ -0,0 +1,128 @@
+#include "bnSpriteBatch.h"
+#include "bnProfiler.h"
+
+const std::vector<SmartShader::Uniform> SpriteBatch::noUniforms;
+
+SpriteBatch::SpriteBatch() : vertices(sf::Triangles) {
+  target = nullptr;
+  texture = nullptr;
+  shader = nullptr;
+  uniforms = nullptr;
+  pendingProgram = nullptr;
+  drawCalls = sprites = 0;
+}
+
+void SpriteBatch::Begin(sf::RenderTarget& target) {
+  if (this->target && this->target != &target) {
+    Flush();
+  }
+
+  this->target = &target;
+  drawCalls = sprites = 0;
+}
+
+void SpriteBatch::End() {
+  Flush();
+  target = nullptr;
+  uniforms = nullptr;
+}
+
+const bool SpriteBatch::IsActive() const {
+  return target != nullptr;
+}
+
+void SpriteBatch::Draw(const sf::Sprite& sprite, const sf::RenderStates& states) {
+  const sf::Texture* spriteTexture = sprite.getTexture();
+
+  if (!target || !spriteTexture) return;
+
+  // Separate shaders holding identical values can share a draw call
+  const sf::Shader* program = uniforms ? uniforms->Get() : nullptr;
+
+  bool sameUniforms = program == pendingProgram
+    && SmartShader::SameUniforms(uniforms ? uniforms->uniforms : noUniforms, pendingUniforms);
+
+  bool sameState = spriteTexture == texture
+    && states.shader == shader
+    && states.blendMode == blendMode
+    && sameUniforms;
+
+  if (vertices.getVertexCount() > 0 && !sameState) {
+    Flush();
+  }
+
+  if (vertices.getVertexCount() == 0) {
+    // assign() keeps the capacity so steady state frames do not allocate
+    const std::vector<SmartShader::Uniform>& values = uniforms ? uniforms->uniforms : noUniforms;
+    pendingUniforms.assign(values.begin(), values.end());
+    pendingProgram = program;
+  }
+
+  texture = spriteTexture;
+  shader = states.shader;
+  blendMode = states.blendMode;
+
+  // Same corners and texture coordinates sf::Sprite uses
+  const sf::IntRect& rect = sprite.getTextureRect();
+  sf::FloatRect bounds = sprite.getLocalBounds();
+  sf::Transform transform = states.transform * sprite.getTransform();
+  sf::Color color = sprite.getColor();
+
+  float left = static_cast<float>(rect.left);
+  float right = left + rect.width;
+  float top = static_cast<float>(rect.top);
+  float bottom = top + rect.height;
+
+  sf::Vertex topLeft(transform.transformPoint(0.f, 0.f), color, sf::Vector2f(left, top));
+  sf::Vertex bottomLeft(transform.transformPoint(0.f, bounds.height), color, sf::Vector2f(left, bottom));
+  sf::Vertex topRight(transform.transformPoint(bounds.width, 0.f), color, sf::Vector2f(right, top));
+  sf::Vertex bottomRight(transform.transformPoint(bounds.width, bounds.height), color, sf::Vector2f(right, bottom));
+
+  vertices.append(topLeft);
+  vertices.append(bottomLeft);
+  vertices.append(topRight);
+  vertices.append(topRight);
+  vertices.append(bottomLeft);
+  vertices.append(bottomRight);
+
+  sprites++;
+}
+
+void SpriteBatch::Flush() {
+  if (!target || vertices.getVertexCount() == 0) return;
+
+  PROFILE_ZONE("SpriteBatch::Flush");
+
+  // Transforms are already baked into the vertices
+  sf::RenderStates states(blendMode, sf::Transform::Identity, texture, shader);
+
+  // Children drawn with their own shader do not take the parent's uniforms
+  if (pendingProgram && pendingProgram == shader) {
+    SmartShader::Sync(const_cast<sf::Shader*>(shader), pendingUniforms);
+  }
+  else if (shader) {
+    SmartShader::ApplyDefaults(shader);
+  }
+
+  target->draw(vertices, states);
+
+  // clear() keeps the capacity so steady state frames do not allocate
+  vertices.clear();
+  drawCalls++;
+}
+
+void SpriteBatch::SetUniforms(SmartShader* uniforms) {
+  this->uniforms = uniforms;
+}
+
+sf::RenderTarget* SpriteBatch::GetTarget() const {
+  return target;
+}
+
+const unsigned SpriteBatch::GetDrawCalls() const {
+  return drawCalls;
+}
+
+const unsigned SpriteBatch::GetSpriteCount() const {
+  return sprites;
+}
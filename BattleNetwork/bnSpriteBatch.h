@@ -0,0 +1,97 @@
+/*! \file bnSpriteBatch.h */
+
+/*! \brief Collects textured quads and submits them in as few draw calls as possible
+ *
+ * The battle field used to issue one draw call per tile and per entity.
+ * The batch bakes each sprite's transform into its vertices on the CPU and appends
+ * them to one vertex array. Consecutive sprites that share a texture, shader,
+ * blend mode and uniform set end up in the same draw call.
+ *
+ * Draw order is never changed: the batch is flushed as soon as the next sprite
+ * needs a different state, or when something that is not a sprite must draw in between.
+ */
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+#include "bnSmartShader.h"
+
+class SpriteBatch {
+public:
+  SpriteBatch();
+
+  SpriteBatch(const SpriteBatch&) = delete;
+  SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+  /**
+   * @brief Starts collecting sprites for target. Resets the draw call count.
+   * @param target where the batched sprites will be drawn
+   */
+  void Begin(sf::RenderTarget& target);
+
+  /**
+   * @brief Flushes the remaining sprites and stops batching
+   */
+  void End();
+
+  /**
+   * @brief Query if the batch is between Begin() and End()
+   */
+  const bool IsActive() const;
+
+  /**
+   * @brief Appends the sprite as a quad. Flushes first if the render states differ from the batch.
+   * @param sprite sprite to draw. Sprites without a texture are skipped like sf::Sprite does.
+   * @param states parent transform, shader and blend mode
+   */
+  void Draw(const sf::Sprite& sprite, const sf::RenderStates& states);
+
+  /**
+   * @brief Submits the pending quads in one draw call
+   */
+  void Flush();
+
+  /**
+   * @brief Sets the SmartShader whose uniforms apply to the sprites drawn next
+   *
+   * Different uniform sets cannot share a draw call, so the uniforms are part of the batch key.
+   * Their values are copied when a sprite starts a batch and that copy is applied when
+   * the batch is flushed, so the shader may change or go away in the meantime.
+   *
+   * @param uniforms shader with uniforms or nullptr
+   */
+  void SetUniforms(SmartShader* uniforms);
+
+  /**
+   * @brief The target passed to Begin()
+   * @return sf::RenderTarget* or nullptr if not batching
+   */
+  sf::RenderTarget* GetTarget() const;
+
+  /**
+   * @brief Number of draw calls submitted since Begin()
+   */
+  const unsigned GetDrawCalls() const;
+
+  /**
+   * @brief Number of sprites drawn since Begin()
+   */
+  const unsigned GetSpriteCount() const;
+
+private:
+  sf::RenderTarget* target;
+  sf::VertexArray vertices; /*!< Pending quads as triangles. Capacity is kept between frames */
+
+  // The batch key
+  const sf::Texture* texture;
+  const sf::Shader* shader;
+  sf::BlendMode blendMode;
+  SmartShader* uniforms; /*!< Uniforms set for the next sprites */
+  const sf::Shader* pendingProgram; /*!< Program the pending uniforms were set for */
+  std::vector<SmartShader::Uniform> pendingUniforms; /*!< Copy of the values the pending quads were added with */
+  static const std::vector<SmartShader::Uniform> noUniforms; /*!< Stands in when no uniforms are set */
+
+  unsigned drawCalls;
+  unsigned sprites;
+};
@@ -1,4 +1,5 @@
 #include "bnSpriteSceneNode.h"
+#include "bnSpriteBatch.h"
 
 SpriteSceneNode::SpriteSceneNode() : SceneNode() {
   sprite = new sf::Sprite();
@@ -57,6 +58,12 @@ sf::FloatRect SpriteSceneNode::getLocalBounds() {
 
 void SpriteSceneNode::setTexture(const sf::Texture& texture, bool resetRect) {
   sprite->setTexture(texture, resetRect);
+  textureHandle.reset();
+}
+
+void SpriteSceneNode::setTexture(const std::shared_ptr<sf::Texture>& texture, bool resetRect) {
+  sprite->setTexture(*texture, resetRect);
+  textureHandle = texture;
 }
 
 void SpriteSceneNode::SetShader(sf::Shader* _shader) {
@@ -78,39 +85,111 @@ SmartShader& SpriteSceneNode::GetShader() {
   return shader;
 }
 
+const SmartShader& SpriteSceneNode::GetShader() const {
+  return shader;
+}
+
 void SpriteSceneNode::RevokeShader() {
   shader.Reset();
 }
 
-void SpriteSceneNode::draw(sf::RenderTarget& target, sf::RenderStates states) const {
-  if (!show) return;
+void SpriteSceneNode::BuildDrawList() const {
+  if (!drawListDirty) return;
+
+  drawNodes.clear();
+  drawOps.clear();
+
+  Flatten(*this, -1);
+
+  drawStates.resize(drawNodes.size());
+  drawVisible.resize(drawNodes.size());
+
+  drawListDirty = false;
+}
+
+void SpriteSceneNode::Flatten(const SpriteSceneNode& node, int parent) const {
+  const int state = (int)drawNodes.size();
+  drawNodes.push_back({ &node, parent });
+
+  // Children are sorted by descending layer. The proxy sprite goes after every child at or above its layer.
+  bool proxyAdded = false;
+
+  for (auto child : node.childNodes) {
+    if (!proxyAdded && child->GetLayer() < node.GetLayer()) {
+      drawOps.push_back({ &node, state, true });
+      proxyAdded = true;
+    }
+
+    if (auto sprite = dynamic_cast<const SpriteSceneNode*>(child)) {
+      Flatten(*sprite, state);
+    }
+    else {
+      drawOps.push_back({ child, state, false });
+    }
+  }
 
-  // combine the parent transform with the node's one
-  sf::Transform combinedTransform =this->getTransform();
+  if (!proxyAdded) {
+    drawOps.push_back({ &node, state, true });
+  }
+}
+
+void SpriteSceneNode::ResolveDrawStates(const sf::RenderStates& states) const {
+  for (size_t i = 0; i < drawNodes.size(); i++) {
+    const SpriteSceneNode& node = *drawNodes[i].node;
+    const int parent = drawNodes[i].parent;
+
+    sf::RenderStates& resolved = drawStates[i];
+    resolved = parent < 0 ? states : drawStates[parent];
+    drawVisible[i] = node.show && (parent < 0 || drawVisible[parent]);
+
+    if (!drawVisible[i]) continue;
 
-  states.transform *= combinedTransform;
+    // combine the parent transform with the node's one
+    resolved.transform *= node.getTransform();
 
-  const sf::Shader* s = const_cast<const sf::Shader*>(shader.Get());
+    const sf::Shader* s = const_cast<const sf::Shader*>(node.shader.Get());
 
-  if (s) {
-    states.shader = s;
+    if (s) {
+      resolved.shader = s;
+    }
+    else if (!node.IsUsingParentShader()) {
+      resolved.shader = nullptr;
+    }
   }
-  else if(!IsUsingParentShader()){
-    states.shader = nullptr;
+}
+
+void SpriteSceneNode::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+  if (!show) return;
+
+  BuildDrawList();
+  ResolveDrawStates(states);
+
+  for (auto& op : drawOps) {
+    if (!drawVisible[op.state]) continue;
+
+    if (op.proxy) {
+      target.draw(*static_cast<const SpriteSceneNode*>(op.node)->sprite, drawStates[op.state]);
+    }
+    else {
+      op.node->draw(target, drawStates[op.state]);
+    }
   }
+}
 
-  std::vector<SceneNode*> copies = this->childNodes;
-  copies.push_back((SceneNode*)this);
+void SpriteSceneNode::DrawBatched(SpriteBatch& batch, sf::RenderStates states) const {
+  if (!show) return;
 
-  std::sort(copies.begin(), copies.end(), [](SceneNode* a, SceneNode* b) { return (a->GetLayer() > b->GetLayer()); });
+  BuildDrawList();
+  ResolveDrawStates(states);
 
-  // draw its children
-  for (std::size_t i = 0; i < copies.size(); i++) {
-    // If it's time to draw our scene node, we draw the proxy sprite
-    if(copies[i] == this) {
-      target.draw(*sprite, states);
-    } else {
-      copies[i]->draw(target, states);
+  for (auto& op : drawOps) {
+    if (!drawVisible[op.state]) continue;
+
+    if (op.proxy) {
+      batch.Draw(*static_cast<const SpriteSceneNode*>(op.node)->sprite, drawStates[op.state]);
+    }
+    else {
+      op.node->DrawBatched(batch, drawStates[op.state]);
     }
   }
 }
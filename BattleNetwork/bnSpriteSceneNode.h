@@ -4,21 +4,65 @@
  * Every Entity instance is a SpriteSceneNode
  * 
  * SpriteSceneNodes are special scene nodes. They can have child nodes with a Z 
- * order in front of themselves. To achieve this, during the draw, the sprite and
- * its children are sorted by Z. When the sprite scene node is next to draw,
- * the sprite scene node draws the proxied sprite instead. This allows sprites to have
+ * order in front of themselves. Children on a layer at or above the node's own
+ * draw first, then the proxied sprite, then the rest. This allows sprites to have
  * children sprites that can be drawn in front and behind of them for special effects
  * and UI.
+ * 
+ * The draw order of the whole subtree (e.g. the player with its aura, charge effect
+ * and shadow) is flattened into a list that is only rebuilt when a child is added,
+ * removed or changes layer. Drawing walks the list without recursing or sorting.
  */
 #pragma once
 #include "bnSceneNode.h"
 #include "bnSmartShader.h"
 
+#include <memory>
+#include <vector>
+
 class SpriteSceneNode : public SceneNode {
 private:
   bool allocatedSprite; /*!< Whether or not SpriteSceneNode owns the sprite pointer */
   mutable SmartShader shader; /*!< Sprites can have shaders attached to them */
   sf::Sprite* sprite; /*!< Reference to sprite behind proxy */
+  std::shared_ptr<sf::Texture> textureHandle; /*!< Keeps a cached texture alive while the sprite uses it */
+
+  /**
+   * @brief A sprite node in the flattened subtree and the index of the sprite node it inherits states from
+   */
+  struct DrawNode {
+    const SpriteSceneNode* node;
+    int parent; /*!< -1 for the root */
+  };
+
+  /**
+   * @brief One draw in the flattened subtree
+   */
+  struct DrawOp {
+    const SceneNode* node; /*!< The sprite node itself if proxy is true, otherwise a plain scene node */
+    int state; /*!< Index into drawNodes whose states are used */
+    bool proxy; /*!< Draw the proxied sprite instead of delegating to the node */
+  };
+
+  mutable std::vector<DrawNode> drawNodes; /*!< Sprite nodes of the subtree, parents before children */
+  mutable std::vector<DrawOp> drawOps; /*!< Subtree draws in order */
+  mutable std::vector<sf::RenderStates> drawStates; /*!< Per frame scratch, one per drawNodes entry */
+  mutable std::vector<char> drawVisible; /*!< Per frame scratch, one per drawNodes entry */
+
+  /**
+   * @brief Rebuilds drawNodes and drawOps if anything in the subtree changed
+   */
+  void BuildDrawList() const;
+
+  /**
+   * @brief Appends node and its sprite descendants to the draw list
+   */
+  void Flatten(const SpriteSceneNode& node, int parent) const;
+
+  /**
+   * @brief Resolves the transform, shader and visibility of every sprite node in the subtree
+   */
+  void ResolveDrawStates(const sf::RenderStates& states) const;
 
 public:
   /**
@@ -104,6 +148,13 @@ public:
    */
   void setTexture(const sf::Texture& texture, bool resetRect = false);
 
+  /**
+   * @brief Set sprite texture proxy and share ownership of the texture
+   * @param texture handle from TextureResourceManager
+   * @param resetRect
+   */
+  void setTexture(const std::shared_ptr<sf::Texture>& texture, bool resetRect = false);
+
   /**
    * @brief Converts sf::Shader to SmartShader and attaches it.
    * @param _shader
@@ -125,6 +176,7 @@ public:
    * @return SmartShader&
    */
   SmartShader& GetShader();
+  const SmartShader& GetShader() const;
 
   /**
    * @brief Revokes the attached shader
@@ -136,8 +188,16 @@ public:
    * @param target
    * @param states
    * 
-   * SpriteSceneNodes can have child nodes in front of them. To achieve this,
-   * we sort by Z and if this sprite node is to be drawn, drawns the proxy sprite
+   * SpriteSceneNodes can have child nodes in front of them. The flattened draw
+   * list interleaves the proxy sprite with the children by layer.
+   * Final so every sprite node in a subtree can be flattened into its root's list.
+   */
+  virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const final;
+
+  /**
+   * @brief Same as draw() but the proxy sprite and sprite children are added to the batch
+   * @param batch
+   * @param states
    */
-  virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+  virtual void DrawBatched(SpriteBatch& batch, sf::RenderStates states) const final;
 };
@@ -18,10 +18,10 @@ Mob* StarfishMob::Build() {
   mob->RegisterRankedReward(1, BattleItem(Chip(75, 147, 'R', 30, Element::NONE, "Recov30", "Recover 30HP", "", 1)));
   mob->RegisterRankedReward(11, BattleItem(Chip(81, 153, 'R', 300, Element::NONE, "Recov300", "Recover 300HP", "", 5)));
 
-  mob->Spawn<Rank1<Starfish>>(4 + (rand() % 3), 1);
-  mob->Spawn<Rank1<Starfish>>(4 + (rand() % 3), 3);
+  mob->Spawn<Rank1<Starfish>>(4 + field->GetRandom().Next(3), 1);
+  mob->Spawn<Rank1<Starfish>>(4 + field->GetRandom().Next(3), 3);
 
-  bool allIce = !(rand() % 10);
+  bool allIce = !field->GetRandom().Next(10);
 
   for (auto t : field->FindTiles([](Battle::Tile* t) { return true; })) {
     if (allIce) {
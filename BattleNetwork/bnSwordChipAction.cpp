@@ -14,13 +14,17 @@
 
 #define FRAMES FRAME1, FRAME2, FRAME3
 
+static const int HILT_POINT = FramePoints::Intern("HILT");
+static const int ENDPOINT_POINT = FramePoints::Intern("endpoint");
+
 SwordChipAction::SwordChipAction(Character * owner, int damage) : ChipAction(owner, "PLAYER_SWORD", &attachment, "HILT"), attachmentAnim(ANIM) {
   this->damage = damage;
 
   attachmentAnim.Reload();
   attachmentAnim.SetAnimation("DEFAULT");
 
-  overlay.setTexture(*TextureResourceManager::GetInstance().LoadTextureFromFile(PATH));
+  overlayTexture = TextureResourceManager::GetInstance().LoadTextureFromFile(PATH);
+  overlay.setTexture(*overlayTexture);
   this->attachment = new SpriteSceneNode(overlay);
   this->attachment->SetLayer(-2);
 
@@ -32,7 +36,7 @@ SwordChipAction::SwordChipAction(Character * owner, int damage) : ChipAction(own
   hiltAttachmentAnim.Reload();
   hiltAttachmentAnim.SetAnimation("HILT");
 
-  overlay.setTexture(*TextureResourceManager::GetInstance().LoadTextureFromFile(PATH));
+  overlay.setTexture(*overlayTexture);
   attachmentAnim = Animation(ANIM);
   attachmentAnim.Reload();
   attachmentAnim.SetAnimation("DEFAULT");
@@ -111,13 +115,13 @@ void SwordChipAction::OnUpdate(float _elapsed)
 
   // update node position in the animation:
   // Position the hilt
-  auto baseOffset = this->anim->GetPoint("HILT");
+  auto baseOffset = this->anim->GetPoint(HILT_POINT);
   auto origin = GetOwner()->getSprite().getOrigin();
   baseOffset = baseOffset - origin;
   hiltAttachment->setPosition(baseOffset);
 
   // position the blade
-  baseOffset = hiltAttachmentAnim.GetPoint("endpoint");
+  baseOffset = hiltAttachmentAnim.GetPoint(ENDPOINT_POINT);
   origin = hiltAttachment->getOrigin();
   baseOffset = baseOffset - origin;
   attachment->setPosition(baseOffset);
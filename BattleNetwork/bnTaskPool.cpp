@@ -0,0 +1,86 @@
+#include "bnTaskPool.h"
+#include "bnProfiler.h"
+
+TaskPool::TaskPool(unsigned workerCount) : running(0), stopping(false) {
+  if (workerCount == 0) {
+    workerCount = std::thread::hardware_concurrency();
+  }
+
+  // hardware_concurrency() may report 0 if unknown
+  if (workerCount == 0) {
+    workerCount = 1;
+  }
+
+  workers.reserve(workerCount);
+
+  for (unsigned i = 0; i < workerCount; i++) {
+    workers.emplace_back(&TaskPool::Work, this);
+  }
+}
+
+TaskPool::~TaskPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+
+  taskReady.notify_all();
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+void TaskPool::Submit(Task task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push(std::move(task));
+  }
+
+  taskReady.notify_one();
+}
+
+void TaskPool::Wait() {
+  std::unique_lock<std::mutex> lock(mutex);
+  allDone.wait(lock, [this]() { return tasks.empty() && running == 0; });
+}
+
+bool TaskPool::IsIdle() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return tasks.empty() && running == 0;
+}
+
+const unsigned TaskPool::GetWorkerCount() const {
+  return (unsigned)workers.size();
+}
+
+void TaskPool::Work() {
+#if BN_PROFILE
+  PROFILER.SetThreadName("TaskPool worker");
+#endif
+
+  std::unique_lock<std::mutex> lock(mutex);
+
+  while (true) {
+    taskReady.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+    // Drain the queue before stopping
+    if (tasks.empty()) {
+      return;
+    }
+
+    Task task = std::move(tasks.front());
+    tasks.pop();
+    running++;
+
+    lock.unlock();
+    task();
+    lock.lock();
+
+    running--;
+
+    if (tasks.empty() && running == 0) {
+      allDone.notify_all();
+    }
+  }
+}
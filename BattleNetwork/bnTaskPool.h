@@ -0,0 +1,64 @@
+/*! \file bnTaskPool.h */
+
+/*! \brief Fixed size pool of worker threads that run queued tasks
+ *
+ * Used at startup to decode images and sound buffers on every core.
+ * Tasks must not touch the GL context. Anything that needs the context
+ * (e.g. texture uploads) is handed back to the main thread by the task itself.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class TaskPool {
+public:
+  using Task = std::function<void()>;
+
+  /**
+   * @brief Starts the workers
+   * @param workers number of threads. 0 uses the number of hardware threads.
+   */
+  TaskPool(unsigned workers = 0);
+
+  /**
+   * @brief Finishes every queued task and joins the workers
+   */
+  ~TaskPool();
+
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+
+  /**
+   * @brief Queue a task to run on the next free worker
+   */
+  void Submit(Task task);
+
+  /**
+   * @brief Blocks until the queue is empty and every worker is idle
+   */
+  void Wait();
+
+  /**
+   * @brief Query if there are no queued or running tasks
+   */
+  bool IsIdle();
+
+  const unsigned GetWorkerCount() const;
+
+private:
+  void Work();
+
+  std::vector<std::thread> workers;
+  std::queue<Task> tasks;
+  std::mutex mutex;
+  std::condition_variable taskReady; /*!< Wakes workers */
+  std::condition_variable allDone; /*!< Wakes Wait() */
+  unsigned running; /*!< Tasks being run right now */
+  bool stopping;
+};
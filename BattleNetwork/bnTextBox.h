@@ -9,7 +9,7 @@
 
 class TextBox : public sf::Drawable, public sf::Transformable {
 private:
-  sf::Font* font;
+  std::shared_ptr<sf::Font> font;
   mutable sf::Text text;
   double charsPerSecond; /**< default is 10 cps */
   double progress; /**< Total elapsed time */
@@ -138,7 +138,6 @@ public:
   }
 
   ~TextBox() {
-    delete font;
   }
 
   /**
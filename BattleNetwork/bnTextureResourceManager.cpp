@@ -1,4 +1,6 @@
 #include "bnTextureResourceManager.h"
+#include "bnTaskPool.h"
+#include "bnProfiler.h"
 
 #include <stdlib.h>
 #include <atomic>
@@ -18,33 +20,125 @@ void TextureResourceManager::LoadAllTextures(std::atomic<int> &status) {
     status++;
 
     // TODO: Catch failed resources and try again
-    Texture* texture = nullptr;
-    texture = LoadTextureFromFile(paths[static_cast<int>(textureType)]);
-    if (texture) textures.insert(pair<TextureType, Texture*>(textureType, texture));
+    std::shared_ptr<Texture> texture = LoadTextureFromFile(paths[static_cast<int>(textureType)]);
+    if (texture) textures.insert(pair<TextureType, std::shared_ptr<Texture>>(textureType, texture));
     textureType = (TextureType)(static_cast<int>(textureType) + 1);
   }
 }
 
-Texture* TextureResourceManager::LoadTextureFromFile(string _path) {
-  Texture* texture = new Texture();
+void TextureResourceManager::QueueAllTextures(TaskPool& pool) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    queuedTextures += (unsigned)TEXTURE_TYPE_SIZE;
+  }
+
+  for (int i = 0; i < (int)TEXTURE_TYPE_SIZE; i++) {
+    pool.Submit([this, i]() {
+      PROFILE_ZONE("Textures::Decode");
+
+      const string& path = paths[i];
+      std::unique_ptr<sf::Image> image(new sf::Image());
+
+      // Decoding is pure CPU work. Only the upload needs the GL context.
+      if (!image->loadFromFile(path)) {
+        Logger::Logf(LogLevel::Warning, LogCategory::Resources, "Failed loading texture: %s", path.c_str());
+
+        image.reset();
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      decoded.push(DecodedImage{ (TextureType)i, std::move(image) });
+    });
+  }
+}
+
+unsigned TextureResourceManager::UploadQueuedTextures(unsigned budget, std::atomic<int> &status) {
+  PROFILE_ZONE("Textures::Upload");
+
+  for (unsigned i = 0; i < budget; i++) {
+    DecodedImage next;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if (decoded.empty()) break;
+
+      next = std::move(decoded.front());
+      decoded.pop();
+    }
+
+    const string& path = paths[(int)next.type];
+    std::shared_ptr<Texture> texture = std::make_shared<Texture>();
+
+    if (next.image && texture->loadFromImage(*next.image)) {
+      texture = Cache(path, texture);
+
+      Logger::Logf(LogLevel::Info, LogCategory::Resources, "Loaded texture: %s", path.c_str());
+    }
+
+    textures.insert(pair<TextureType, std::shared_ptr<Texture>>(next.type, texture));
+    status++;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    queuedTextures--;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  return queuedTextures;
+}
+
+std::shared_ptr<Texture> TextureResourceManager::LoadTextureFromFile(const string& _path) {
+  PROFILE_ZONE("Textures::LoadTextureFromFile");
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto iter = textureCache.find(_path);
+
+    if (iter != textureCache.end()) {
+      return iter->second.texture;
+    }
+  }
+
+  std::shared_ptr<Texture> texture = std::make_shared<Texture>();
+
+#if !BN_HEADLESS
+  // Decode outside of the lock so the other thread is not blocked on disk
   if (!texture->loadFromFile(_path)) {
 
-    Logger::GetMutex()->lock();
-    Logger::Logf("Failed loading texture: %s", _path.c_str());
-    Logger::GetMutex()->unlock();
+    Logger::Logf(LogLevel::Warning, LogCategory::Resources, "Failed loading texture: %s", _path.c_str());
 
+    // Don't cache failures so the next request tries the disk again
+    return texture;
   } else {
 
-    Logger::GetMutex()->lock();
-    Logger::Logf("Loaded texture: %s", _path.c_str());
-    Logger::GetMutex()->unlock();
+    Logger::Logf(LogLevel::Info, LogCategory::Resources, "Loaded texture: %s", _path.c_str());
 
   }
-  return texture;
+#endif
+
+  // Headless builds draw nothing so nothing is uploaded. Sprites only need a texture to point at.
+  // The empty texture is still a GL resource and SFML opens its shared context for it.
+  return Cache(_path, texture);
+}
+
+std::shared_ptr<Texture> TextureResourceManager::Cache(const string& _path, const std::shared_ptr<Texture>& texture) {
+  sf::Vector2u size = texture->getSize();
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // If both threads decoded the same file, the first one in wins
+  auto result = textureCache.insert(std::make_pair(_path, CachedTexture{ texture, (size_t)size.x * (size_t)size.y * 4 }));
+
+  if (result.second) {
+    residentBytes += result.first->second.bytes;
+  }
+
+  return result.first->second.texture;
 }
 
 Texture* TextureResourceManager::GetTexture(TextureType _ttype) {
-  return textures.at(_ttype);
+  return textures.at(_ttype).get();
 }
 
 sf::IntRect TextureResourceManager::GetCardRectFromID(unsigned ID) {
@@ -56,17 +150,96 @@ sf::IntRect TextureResourceManager::GetIconRectFromID(unsigned ID) {
   return result;
 }
 
-Font* TextureResourceManager::LoadFontFromFile(string _path) {
-  Font* font = new Font();
+std::shared_ptr<Font> TextureResourceManager::LoadFontFromFile(const string& _path) {
+  PROFILE_ZONE("Textures::LoadFontFromFile");
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto iter = fontCache.find(_path);
+
+    if (iter != fontCache.end()) {
+      return iter->second;
+    }
+  }
+
+  std::shared_ptr<Font> font = std::make_shared<Font>();
+
+  // Read outside of the lock so the other thread is not blocked on disk
   if (!font->loadFromFile(_path)) {
-    Logger::Logf("Failed loading font: %s", _path.c_str());
+    Logger::Logf(LogLevel::Warning, LogCategory::Resources, "Failed loading font: %s", _path.c_str());
+
+    // Don't cache failures so the next request tries the disk again
+    return font;
   } else {
-    Logger::Logf("Loaded font: %s", _path.c_str());
+    Logger::Logf(LogLevel::Info, LogCategory::Resources, "Loaded font: %s", _path.c_str());
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // If both threads loaded the same file, the first one in wins
+  return fontCache.insert(std::make_pair(_path, font)).first->second;
+}
+
+void TextureResourceManager::Evict(const string& _path) {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto iter = textureCache.find(_path);
+
+  if (iter != textureCache.end()) {
+    residentBytes -= iter->second.bytes;
+    textureCache.erase(iter);
+  }
+
+  fontCache.erase(_path);
+}
+
+size_t TextureResourceManager::EvictUnused() {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  size_t released = 0;
+
+  // use_count() == 1 means only the cache refers to the resource
+  for (auto iter = textureCache.begin(); iter != textureCache.end();) {
+    if (iter->second.texture.use_count() == 1) {
+      released += iter->second.bytes;
+      iter = textureCache.erase(iter);
+    }
+    else {
+      iter++;
+    }
   }
-  return font;
+
+  for (auto iter = fontCache.begin(); iter != fontCache.end();) {
+    if (iter->second.use_count() == 1) {
+      iter = fontCache.erase(iter);
+    }
+    else {
+      iter++;
+    }
+  }
+
+  residentBytes -= released;
+
+  Logger::Logf(LogLevel::Info, LogCategory::Resources, "Evicted %u texture bytes. %u bytes resident", (unsigned)released, (unsigned)residentBytes);
+
+  return released;
+}
+
+size_t TextureResourceManager::GetResidentBytes(const string& _path) {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto iter = textureCache.find(_path);
+
+  return iter == textureCache.end() ? 0 : iter->second.bytes;
+}
+
+size_t TextureResourceManager::GetResidentBytes() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return residentBytes;
 }
 
-TextureResourceManager::TextureResourceManager(void) {
+TextureResourceManager::TextureResourceManager(void) : residentBytes(0), queuedTextures(0) {
   //-Tiles-
   //Blue tile
   paths.push_back("resources/tiles/tile_atlas_blue.png");
@@ -271,7 +444,7 @@ TextureResourceManager::TextureResourceManager(void) {
 }
 
 TextureResourceManager::~TextureResourceManager(void) {
-  for (auto it = textures.begin(); it != textures.end(); ++it) {
-    delete it->second;
-  }
+  textures.clear();
+  textureCache.clear();
+  fontCache.clear();
 }
@@ -18,6 +18,9 @@
 
 #include <SFML/Graphics.hpp>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
 #include <vector>
 #include <iostream>
 #include <atomic>
@@ -31,6 +34,8 @@ using sf::Texture;
 using sf::Font;
 using std::string;
 
+class TaskPool;
+
 class TextureResourceManager {
 public:
   /**
@@ -44,13 +49,29 @@ public:
    * @param status Increases the count after each texture loads
    */
   void LoadAllTextures(std::atomic<int> &status);
+
+  /**
+   * @brief Decodes all hard-coded textures on the pool's workers
+   *
+   * Decoded images wait until UploadQueuedTextures() is called from the thread that owns the GL context.
+   * @param pool workers to decode on
+   */
+  void QueueAllTextures(TaskPool& pool);
+
+  /**
+   * @brief Uploads decoded images to the GPU. Call once per frame from the thread that owns the GL context.
+   * @param budget max number of textures to upload in this call
+   * @param status Increases the count after each texture is uploaded
+   * @return number of queued textures that still have to be decoded or uploaded
+   */
+  unsigned UploadQueuedTextures(unsigned budget, std::atomic<int> &status);
   
   /**
-   * @brief Given a file path, returns a pointer to the loaded texture
+   * @brief Given a file path, returns the cached texture. Decodes the file on the first request.
    * @param _path Relative path to the application
-   * @return Texture pointer. Must manually delete.
+   * @return Shared texture handle. Keep it for as long as a sprite references the texture.
    */
-  Texture* LoadTextureFromFile(string _path);
+  std::shared_ptr<Texture> LoadTextureFromFile(const string& _path);
   
   /**
    * @brief Returns pointer to the pre-loaded texture type
@@ -75,17 +96,72 @@ public:
   sf::IntRect GetIconRectFromID(unsigned ID);
   
   /**
-   * @brief Given a file path, returns a pointer to the loaded font
+   * @brief Given a file path, returns the cached font. Loads the file on the first request.
    * @param _path Relative to the application
-   * @return Font pointer. Must manually delete.
+   * @return Shared font handle. Keep it for as long as a text references the font.
+   */
+  std::shared_ptr<Font> LoadFontFromFile(const string& _path);
+
+  /**
+   * @brief Drops the cache entry for path. Outstanding handles keep the resource alive.
+   * @param _path Relative path to the application
+   */
+  void Evict(const string& _path);
+
+  /**
+   * @brief Drops every cached texture and font no handle refers to anymore
+   * @return Number of texture bytes released
    */
-  Font* LoadFontFromFile(string _path);
+  size_t EvictUnused();
+
+  /**
+   * @brief Approximate video memory used by a cached texture (width * height * 4)
+   * @param _path Relative path to the application
+   * @return bytes or 0 if the texture is not cached
+   */
+  size_t GetResidentBytes(const string& _path);
+
+  /**
+   * @brief Approximate video memory used by every cached texture
+   * @return bytes
+   */
+  size_t GetResidentBytes();
 
 private:
   TextureResourceManager();
   ~TextureResourceManager();
+
+  /**
+   * @brief Inserts a texture into the path cache. If the path is already cached the cached texture is returned.
+   */
+  std::shared_ptr<Texture> Cache(const string& _path, const std::shared_ptr<Texture>& texture);
+
+  /**
+   * @struct DecodedImage
+   * @brief Image decoded by a worker waiting for its GL upload
+   */
+  struct DecodedImage {
+    TextureType type;
+    std::unique_ptr<sf::Image> image; /*!< Empty if decoding failed */
+  };
+
+  /**
+   * @struct CachedTexture
+   * @brief Texture handle and its size in bytes
+   */
+  struct CachedTexture {
+    std::shared_ptr<Texture> texture;
+    size_t bytes;
+  };
+
   vector<string> paths; /**< Paths to all textures. Must be in order of TextureType @see TextureType */
-  map<TextureType, Texture*> textures; /**< Cache */
+  map<TextureType, std::shared_ptr<Texture>> textures; /**< Hard-coded textures. Never evicted */
+  map<string, CachedTexture> textureCache; /**< path -> texture */
+  map<string, std::shared_ptr<Font>> fontCache; /**< path -> font */
+  size_t residentBytes; /**< Sum of bytes in textureCache */
+  std::queue<DecodedImage> decoded; /**< Images ready to upload */
+  unsigned queuedTextures; /**< Textures queued by QueueAllTextures() that are not uploaded yet */
+  std::mutex mutex; /**< Textures are loaded from the resource thread and the main thread */
 };
 
 /*! \brief Shorthand to get instance of the manager */
@@ -53,11 +53,12 @@ void Thunder::OnUpdate(float _elapsed) {
   // Find target if we don't have one
   if (!target) {
     // Find all characters that are not on our team and not an obstacle
-    auto query = [&](Entity* e) {
-        return (e->GetTeam() != team && dynamic_cast<Character*>(e) && !dynamic_cast<Obstacle*>(e));
+    // Obstacles are bucketed with spells so the character bucket excludes them
+    auto query = [&](Character* c) {
+      return c->GetTeam() != team;
     };
 
-    auto list = field->FindEntities(query);
+    auto list = field->FindCharacters(query);
 
     for (auto l : list) {
       if (!target) { target = l; }
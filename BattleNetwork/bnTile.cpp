@@ -1,4 +1,5 @@
 #include "bnTile.h"
+#include "bnProfiler.h"
 #include "bnEntity.h"
 #include "bnCharacter.h"
 #include "bnObstacle.h"
@@ -269,6 +270,10 @@ namespace Battle {
     if (!ContainsEntity(&_entity)) {
       spells.push_back(&_entity);
       this->AddEntity(&_entity);
+
+      if (!IsEdgeTile()) {
+        field->IndexEntity(_entity);
+      }
     }
   }
 
@@ -277,6 +282,10 @@ namespace Battle {
     if (!ContainsEntity(&_entity)) {
       characters.push_back(&_entity);
       this->AddEntity(&_entity);
+
+      if (!IsEdgeTile()) {
+        field->IndexEntity(_entity);
+      }
     }
   }
 
@@ -285,6 +294,10 @@ namespace Battle {
     if (!ContainsEntity(&_entity)) {
       spells.push_back(&_entity);
       this->AddEntity(&_entity);
+
+      if (!IsEdgeTile()) {
+        field->IndexEntity(static_cast<Spell&>(_entity));
+      }
     }
   }
 
@@ -293,6 +306,10 @@ namespace Battle {
     if (!ContainsEntity(&_entity)) {
       artifacts.push_back(&_entity);
       this->AddEntity(&_entity);
+
+      if (!IsEdgeTile()) {
+        field->IndexEntity(_entity);
+      }
     }
   }
 
@@ -332,12 +349,16 @@ namespace Battle {
       // TODO: HasFloatShoe and HasAirShoe should be a component and use the component system
 
       // If removing an entity and the tile was broken, crack the tile
-      if(reserved.size() == 0 && dynamic_cast<Character*>(*itEnt) != nullptr && (IsCracked() && !((*itEnt)->HasFloatShoe() || (*itEnt)->HasAirShoe()))) {
+      if(reserved.size() == 0 && (*itEnt)->IsA<Character>() && (IsCracked() && !((*itEnt)->HasFloatShoe() || (*itEnt)->HasAirShoe()))) {
         doBreakState = true;
       }
 
       entities.erase(itEnt);
 
+      if (!IsEdgeTile()) {
+        field->UnindexEntity(ID);
+      }
+
       modified = true;
     }
 
@@ -391,8 +412,7 @@ namespace Battle {
       if (*it == caller)
         continue;
 
-      // TODO: use group buckets to poll by ID instead of dynam casting
-      Character *c = dynamic_cast<Character *>(*it);
+      Character *c = (*it)->As<Character>();
 
       // the entity is a character (can be hit) and the team isn't the same
       // we see if it passes defense checks, then call attack
@@ -416,6 +436,8 @@ namespace Battle {
 
   */
   void Tile::Update(float _elapsed) {
+    PROFILE_ZONE("Tile::Update");
+
     willHighlight = false;
     totalElapsed += _elapsed;
 
@@ -443,8 +465,7 @@ namespace Battle {
         //entities[i]->OnDelete();
 
         if (RemoveEntityByID(ID)) {
-          // TODO: STOP DYNAMIC CASTING! SOMEHOW!
-          Character* character = dynamic_cast<Character*>(ptr);
+          Character* character = ptr->As<Character>();
 
           // We only want to know about character deletions since they are the actors in the battle
           if (character) {
@@ -479,13 +500,9 @@ namespace Battle {
     if (this->isBattleActive) {
       // Now that spells and characters have updated and moved, they are due to check for attack outcomes
       for (auto ID : queuedSpells) {
-        // TODO: REDO THIS LOOP. IT IS HORRIBLE AND COSTLY!
-        auto list = field->FindEntities([ID](Entity* e) {
-          return e->GetID() == ID;
-        });
+        Spell* spell = field->GetSpellByID(ID);
 
-        if (list.size()) {
-          auto spell = dynamic_cast<Spell*>(list[0]);
+        if (spell) {
           this->PerformSpellAttack(spell);
         }
       }
@@ -315,7 +315,7 @@ namespace Battle {
   template<class Type>
   bool Tile::ContainsEntityType() {
     for (vector<Entity*>::iterator it = entities.begin(); it != entities.end(); ++it) {
-      if (dynamic_cast<Type*>(*it) != nullptr) {
+      if ((*it)->template IsA<Type>()) {
         return true;
       }
     }
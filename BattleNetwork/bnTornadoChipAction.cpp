@@ -18,7 +18,8 @@
 TornadoChipAction::TornadoChipAction(Character * owner, int damage) 
   : ChipAction(owner, "PLAYER_SHOOTING", &attachment, "Buster"), attachmentAnim(FAN_ANIM), armIsOut(false) {
   this->damage = damage;
-  fan.setTexture(*TextureResourceManager::GetInstance().LoadTextureFromFile(FAN_PATH));
+  fanTexture = TextureResourceManager::GetInstance().LoadTextureFromFile(FAN_PATH);
+  fan.setTexture(*fanTexture);
   this->attachment = new SpriteSceneNode(fan);
   this->attachment->SetLayer(-1);
 
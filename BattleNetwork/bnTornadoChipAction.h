@@ -2,12 +2,14 @@
 #include "bnChipAction.h"
 #include "bnAnimation.h"
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class SpriteSceneNode;
 class Character;
 class TornadoChipAction : public ChipAction {
 private:
   sf::Sprite fan;
+  std::shared_ptr<sf::Texture> fanTexture;
   SpriteSceneNode* attachment;
   Animation attachmentAnim;
   bool armIsOut;
@@ -27,14 +27,14 @@ Mob* TwoMettaurMob::Build() {
   int count = 2;
 
   // place a hole somewhere
-  field->GetAt( 4 + (rand() % 3), 1 + (rand() % 3))->SetState(TileState::EMPTY);
+  field->GetAt( 4 + field->GetRandom().Next(3), 1 + field->GetRandom().Next(3))->SetState(TileState::EMPTY);
 
   while (count > 0) {
     for (int i = 0; i < field->GetWidth(); i++) {
       for (int j = 0; j < field->GetHeight(); j++) {
         Battle::Tile* tile = field->GetAt(i + 1, j + 1);
 
-        //tile->SetState(TileState(rand()%int(TileState::SIZE)));
+        //tile->SetState(TileState(field->GetRandom().Next(int(TileState::SIZE))));
 
         /*if (tile->GetTeam() == Team::RED) {
           if (i == 1 && j == 1) {
@@ -67,7 +67,7 @@ Mob* TwoMettaurMob::Build() {
         }*/
 
         if (tile->IsWalkable() && tile->GetTeam() == Team::BLUE) {
-          if (rand() % 50 > 25 && count-- > 0)
+          if (field->GetRandom().Next(50) > 25 && count-- > 0)
             mob->Spawn<Rank1<Mettaur>>(i + 1, j + 1);
         }
       }
@@ -2,12 +2,14 @@
 #include "bnChipAction.h"
 #include "bnAnimation.h"
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class SpriteSceneNode;
 class Character;
 class VulcanChipAction : public ChipAction {
 private:
   sf::Sprite overlay;
+  std::shared_ptr<sf::Texture> overlayTexture;
   SpriteSceneNode* attachment;
   Animation attachmentAnim;
   int damage;
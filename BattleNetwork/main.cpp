@@ -14,6 +14,10 @@
  * play. From there, the Swoosh ActivityController controls the state
  * of the app until the user quits. Afterwards all resources
  * are cleaned up.
+ *
+ * --record <file> saves every frame of input after the title screen.
+ * --replay <file> skips the title screen, plays that input back, writes
+ * replay-profile.json and quits when the recording ends.
  */
 
 #include "bnTextureResourceManager.h"
@@ -28,6 +32,12 @@
 #include "bnAnimator.h"
 #include "bnConfigReader.h"
 #include "bnConfigScene.h"
+#include "bnTaskPool.h"
+#include "bnProfiler.h"
+#include "bnProfilerOverlay.h"
+#include "bnInputRecording.h"
+#include "bnFixedStepScheduler.h"
+#include "bnRandom.h"
 #include "SFML/System.hpp"
 
 #include <time.h>
@@ -62,6 +72,19 @@ using swoosh::ActivityController;
 // GBA draws 60 frames in one seconds
 #define FIXED_TIME_STEP 1.0f/60.0f
 
+// After a stall, simulate at most this many ticks before the next draw
+#define MAX_TICKS_PER_FRAME 5
+
+// Decoded textures uploaded to the GPU per title screen frame
+#define TEXTURE_UPLOADS_PER_FRAME 8
+
+// Profiler overlay and trace export keys
+#define PROFILER_OVERLAY_KEY sf::Keyboard::F3
+#define PROFILER_EXPORT_KEY sf::Keyboard::F4
+
+// Where a finished replay writes its profile
+#define REPLAY_PROFILE_PATH "replay-profile.json"
+
 /*! \brief This thread initializes all navis
  * 
  * Uses an std::atomic<int> pointer 
@@ -79,9 +102,7 @@ void RunNaviInit(std::atomic<int>* progress) {
 
   NAVIS.LoadAllNavis(*progress);
 
-  Logger::GetMutex()->lock();
   Logger::Logf("Loaded registered navis: %f secs", float(clock() - begin_time) / CLOCKS_PER_SEC);
-  Logger::GetMutex()->unlock();
 }
 
 /*! \brief This thread tnitializes all mobs
@@ -99,44 +120,25 @@ void RunMobInit(std::atomic<int>* progress) {
 
   MOBS.LoadAllMobs(*progress);
 
-  Logger::GetMutex()->lock();
   Logger::Logf("Loaded registered mobs: %f secs", float(clock() - begin_time) / CLOCKS_PER_SEC);
-  Logger::GetMutex()->unlock();
 }
 
-/*! \brief This thread loads textures and shaders
+/*! \brief Queues texture decoding and loads shaders
+ * 
+ * Textures are decoded on the loader's workers and counted
+ * once they are uploaded by TEXTURES.UploadQueuedTextures().
+ * Shaders compile on this thread because they need the GL context.
  * 
  * Uses and std::atomic<int> pointer to keep
  * count of successfully loaded objects
  */
-void RunGraphicsInit(std::atomic<int> * progress) {
-  clock_t begin_time = clock();
-  TEXTURES.LoadAllTextures(*progress);
-
-  Logger::GetMutex()->lock();
-  Logger::Logf("Loaded textures: %f secs", float(clock() - begin_time) / CLOCKS_PER_SEC);
-  Logger::GetMutex()->unlock();
+void RunGraphicsInit(std::atomic<int> * progress, TaskPool& loader) {
+  TEXTURES.QueueAllTextures(loader);
 
-  begin_time = clock();
+  clock_t begin_time = clock();
   SHADERS.LoadAllShaders(*progress);
 
-  Logger::GetMutex()->lock();
   Logger::Logf("Loaded shaders: %f secs", float(clock() - begin_time) / CLOCKS_PER_SEC);
-  Logger::GetMutex()->unlock();
-}
-
-/*! \brief This thread loads sound effects
- * 
- * Uses and std::atomic<int> pointer to keep
- * count of successfully loaded objects
- */
-void RunAudioInit(std::atomic<int> * progress) {
-  const clock_t begin_time = clock();
-  AUDIO.LoadAllSources(*progress);
-
-  Logger::GetMutex()->lock();
-  Logger::Logf("Loaded audio sources: %f secs", float(clock() - begin_time) / CLOCKS_PER_SEC);
-  Logger::GetMutex()->unlock();
 }
 
 /*! \brief This function describes how the app behaves on focus regain
@@ -171,6 +173,36 @@ void AppLoseFocus() {
 }
 
 int main(int argc, char** argv) {
+#if BN_PROFILE
+  PROFILER.SetThreadName("Main");
+#endif
+
+  // Input recording and playback
+  std::string recordPath, replayPath;
+
+  for (int i = 1; i + 1 < argc; i++) {
+    if (std::string(argv[i]) == "--record") {
+      recordPath = argv[++i];
+    }
+    else if (std::string(argv[i]) == "--replay") {
+      replayPath = argv[++i];
+    }
+  }
+
+  InputRecording recording;
+
+  if (!replayPath.empty() && !recording.Load(replayPath)) {
+    replayPath.clear();
+  }
+  else if (replayPath.empty() && !recordPath.empty()) {
+    recording.SetSeed(Random::MakeSeed());
+  }
+
+  if (!replayPath.empty() || !recordPath.empty()) {
+    // Every battle seed comes from this so the replay builds the same fights
+    Random::SetSessionSeed(recording.GetSeed());
+  }
+
   // Initialize the engine and log the startup time
   const clock_t begin_time = clock();
   ENGINE.Initialize();
@@ -208,14 +240,14 @@ int main(int argc, char** argv) {
     Because the resource managers have yet to be loaded 
     We must manually load some graphics ourselves
   */
-  sf::Texture* alert = TEXTURES.LoadTextureFromFile("resources/ui/alert.png");
+  std::shared_ptr<sf::Texture> alert = TEXTURES.LoadTextureFromFile("resources/ui/alert.png");
   sf::Sprite alertSprite(*alert);
   alertSprite.setScale(2.f, 2.f);
   alertSprite.setOrigin(alertSprite.getLocalBounds().width / 2, alertSprite.getLocalBounds().height / 2);
   sf::Vector2f alertPos = (sf::Vector2f)((sf::Vector2i)ENGINE.GetWindow()->getSize() / 2);
   alertSprite.setPosition(sf::Vector2f(100.f, alertPos.y));
 
-  sf::Texture* mouseTexture = TEXTURES.LoadTextureFromFile("resources/ui/mouse.png");
+  std::shared_ptr<sf::Texture> mouseTexture = TEXTURES.LoadTextureFromFile("resources/ui/mouse.png");
   sf::Sprite mouse(*mouseTexture);
   mouse.setScale(2.f, 2.f);
   Animation mouseAnimation("resources/ui/mouse.animation");
@@ -227,9 +259,9 @@ int main(int argc, char** argv) {
 
   // Title screen logo based on region
 #if OBN_REGION_JAPAN
-  sf::Texture* logo = TEXTURES.LoadTextureFromFile("resources/backgrounds/title/tile.png");
+  std::shared_ptr<sf::Texture> logo = TEXTURES.LoadTextureFromFile("resources/backgrounds/title/tile.png");
 #else
-  sf::Texture* logo = TEXTURES.LoadTextureFromFile("resources/backgrounds/title/tile_en.png");
+  std::shared_ptr<sf::Texture> logo = TEXTURES.LoadTextureFromFile("resources/backgrounds/title/tile_en.png");
 #endif
 
   SpriteSceneNode logoSprite;
@@ -240,14 +272,14 @@ int main(int argc, char** argv) {
   logoSprite.setPosition(logoPos);
 
   // Log output text
-  sf::Font* font = TEXTURES.LoadFontFromFile("resources/fonts/NETNAVI_4-6_V3.ttf");
+  std::shared_ptr<sf::Font> font = TEXTURES.LoadFontFromFile("resources/fonts/NETNAVI_4-6_V3.ttf");
   sf::Text* logLabel = new sf::Text("...", *font);
   logLabel->setCharacterSize(10);
   logLabel->setOrigin(0.f, logLabel->getLocalBounds().height);
   std::vector<std::string> logs;
 
   // Press Start text
-  sf::Font* startFont = TEXTURES.LoadFontFromFile("resources/fonts/mmbnthick_regular.ttf");
+  std::shared_ptr<sf::Font> startFont = TEXTURES.LoadFontFromFile("resources/fonts/mmbnthick_regular.ttf");
 
 #if defined(__ANDROID__)
   sf::Text* startLabel = new sf::Text("TAP SCREEN", *startFont);
@@ -364,22 +396,26 @@ int main(int argc, char** argv) {
   std::atomic<int> navisLoaded{0};
   std::atomic<int> mobsLoaded{0};
 
-  RunGraphicsInit(&progress);
+  // Decode images and sound buffers on every core while the title screen animates.
+  // Only the GL uploads come back to this thread, a few per frame.
+  TaskPool loader;
+  Logger::Logf("Decoding media on %u threads", loader.GetWorkerCount());
+
+  sf::Clock mediaClock;
+  bool texturesUploaded = false;
+
+  RunGraphicsInit(&progress, loader);
+  AUDIO.QueueAllSources(loader, progress);
   ENGINE.SetShader(nullptr);
 
 #ifdef __ANDROID__
   loadSurface.setDefaultShader(&LOAD_SHADER(DEFAULT));
 #endif
 
-    //sf::Thread graphicsLoad(&RunGraphicsInit, &progress);
-  sf::Thread audioLoad(&RunAudioInit, &progress);
-
   // We must deffer these threads until graphics and audio are finished
   sf::Thread navisLoad(&RunNaviInit, &navisLoaded);
   sf::Thread mobsLoad(&RunMobInit, &mobsLoaded);
 
-  audioLoad.launch();
-
   // stream some music while we wait
   AUDIO.Stream("resources/loops/loop_theme.ogg");
 
@@ -405,6 +441,12 @@ int main(int argc, char** argv) {
     
     INPUT.Update();
 
+    if (!texturesUploaded && TEXTURES.UploadQueuedTextures(TEXTURE_UPLOADS_PER_FRAME, progress) == 0) {
+      texturesUploaded = true;
+
+      Logger::Logf("Loaded textures: %f secs", mediaClock.getElapsedTime().asSeconds());
+    }
+
     // Set title bar to loading %
     float percentage = (float)progress / (float)totalObjects;
     std::string percentageStr = std::to_string((int)(percentage*100));
@@ -434,11 +476,9 @@ int main(int argc, char** argv) {
     */
     std::string log;
 
-    Logger::GetMutex()->lock();
     if(Logger::GetNextLog(log)) {
       logs.insert(logs.begin(), log);
     }
-    Logger::GetMutex()->unlock();
 
     // If progress is equal to total resources, 
     // we can show graphics and load external data
@@ -613,6 +653,9 @@ int main(int argc, char** argv) {
 
             bool shouldStart = (INPUT.IsConfigFileValid()? INPUT.Has(EventTypes::PRESSED_CONFIRM) : false) || INPUT.GetAnyKey() == sf::Keyboard::Return;
 
+            // Nobody is at the controller for a replay
+            shouldStart = shouldStart || !replayPath.empty();
+
 #ifdef __ANDROID__
             shouldStart = sf::Touch::isDown(0);
 #endif
@@ -657,6 +700,8 @@ int main(int argc, char** argv) {
             bool shouldStart  = (INPUT.IsConfigFileValid() ? INPUT.Has(EventTypes::PRESSED_CONFIRM) : false) || INPUT.GetAnyKey() == sf::Keyboard::Return;
             bool pressedUp    = (INPUT.IsConfigFileValid() ? INPUT.Has(EventTypes::PRESSED_UI_UP)   : false) || INPUT.GetAnyKey() == sf::Keyboard::Up;
             bool pressedDown  = (INPUT.IsConfigFileValid() ? INPUT.Has(EventTypes::PRESSED_UI_DOWN) : false) || INPUT.GetAnyKey() == sf::Keyboard::Down;
+
+            shouldStart = shouldStart || !replayPath.empty();
             
             if (pressedUp) {
               if (selected != 0) {
@@ -705,8 +750,13 @@ int main(int argc, char** argv) {
     // Finally, everything is drawn to window buffer, display it to screen
     ENGINE.GetWindow()->display();
 
+    // Play the sounds requested this frame
+    AUDIO.Flush();
+
     elapsed = static_cast<float>(clock.getElapsedTime().asMilliseconds());
     totalElapsed += elapsed;
+
+    PROFILER.EndFrame();
   }
 
     // Do not clear the Engine's render surface
@@ -726,8 +776,6 @@ int main(int argc, char** argv) {
   delete navisLoadedLabel;
 
   //delete logLabel;
-  //delete font;
-  delete logo;
 
   // Stop music and go to menu screen
   AUDIO.StopStream();
@@ -755,21 +803,77 @@ int main(int argc, char** argv) {
   // And draws it with supported transition effects
   app.push<FakeScene>(loadingScreenSnapshot);
 
-  double remainder = 0;
+  // Game time advances in fixed ticks no matter how fast frames are drawn
+  FixedStepScheduler scheduler(FIXED_TIME_STEP, MAX_TICKS_PER_FRAME);
   elapsed = 0;
 
-  srand((unsigned int)time(nullptr));
-
   logLabel->setFillColor(sf::Color::Red);
   logLabel->setPosition(296,18);
   logLabel->setStyle(sf::Text::Style::Bold);
 
+  ProfilerOverlay profilerOverlay(font);
+
+  // Recordings start at the first frame after the title screen
+  if (!replayPath.empty()) {
+    Logger::Logf("Replaying %u frames from %s", recording.GetFrameCount(), replayPath.c_str());
+    INPUT.BeginReplay(recording);
+  }
+  else if (!recordPath.empty()) {
+    INPUT.BeginRecording(recording);
+  }
+
+  clock.restart();
+
   // Make sure we didn't quit the loop prematurely
   while (ENGINE.Running()) {
-      // Non-simulation
-      elapsed = static_cast<float>(clock.restart().asSeconds()) + static_cast<float>(remainder);
+    {
+      PROFILE_ZONE("Frame");
+
+      elapsed = static_cast<float>(clock.restart().asSeconds());
+      scheduler.BeginFrame(elapsed);
+
+      bool replayFinished = false;
+
+      // Input is polled once per tick so recordings replay tick for tick
+      while (scheduler.Tick()) {
+        // Checked before polling so the last recorded frame still gets its tick
+        if (INPUT.IsReplayFinished()) {
+          replayFinished = true;
+          break;
+        }
+
+        INPUT.Update();
+
+        if (INPUT.GetAnyKey() == PROFILER_OVERLAY_KEY) {
+          profilerOverlay.Toggle();
+        }
+        else if (INPUT.GetAnyKey() == PROFILER_EXPORT_KEY) {
+          if (PROFILER.ExportChromeTrace("profile.json")) {
+            Logger::Log("Wrote profiler trace to profile.json");
+          }
+          else {
+            Logger::Log("Failed writing profiler trace to profile.json");
+          }
+        }
 
-      INPUT.Update();
+        // Use the activity controller to update scenes
+        {
+          PROFILE_ZONE("ActivityController::update");
+          app.update((float)scheduler.GetStep());
+        }
+      }
+
+      // Sounds requested by every tick this frame play together
+      AUDIO.Flush();
+
+      if (replayFinished) {
+        if (PROFILER.ExportChromeTrace(REPLAY_PROFILE_PATH)) {
+          Logger::Log("Replay finished. Wrote profiler trace to " REPLAY_PROFILE_PATH);
+        }
+
+        ENGINE.GetWindow()->close();
+        break;
+      }
 
       float FPS = 0.f;
 
@@ -780,11 +884,8 @@ int main(int argc, char** argv) {
 
       logLabel->setString(sf::String(std::string("FPS: ") + fpsStr));
 
-      // Use the activity controller to update and draw scenes
-      app.update((float) FIXED_TIME_STEP);
-
       sf::Vector2f mousepos = ENGINE.GetWindow()->mapPixelToCoords(sf::Mouse::getPosition(*ENGINE.GetWindow()));
-      mouseAlpha -= FIXED_TIME_STEP;
+      mouseAlpha -= elapsed;
       mouseAlpha = std::max(0.0, mouseAlpha);
 
       if (mousepos != lastMousepos) {
@@ -794,7 +895,10 @@ int main(int argc, char** argv) {
 
       mouse.setPosition(mousepos);
       mouse.setColor(sf::Color(255, 255, 255, (sf::Uint8) (255 * mouseAlpha)));
-      mouseAnimation.Update((float) FIXED_TIME_STEP, mouse);
+      mouseAnimation.Update(elapsed, mouse);
+
+      // Entities are drawn this far between the last tick and the next
+      ENGINE.SetInterpolationAlpha(scheduler.GetAlpha());
 
       ENGINE.Clear();
 
@@ -805,7 +909,11 @@ int main(int argc, char** argv) {
       states.shader = SHADERS.GetShader(ShaderType::DEFAULT);
 #endif 
 
-      app.draw(loadSurface);
+      {
+        PROFILE_ZONE("ActivityController::draw");
+        app.draw(loadSurface);
+      }
+
       loadSurface.display();
 
       sf::Sprite toScreen(loadSurface.getTexture());
@@ -817,12 +925,27 @@ int main(int argc, char** argv) {
       //ENGINE.GetWindow()->draw(mouse, states);
 #endif
 
+      profilerOverlay.Update();
+      ENGINE.GetWindow()->draw(profilerOverlay, states);
+
       ENGINE.GetWindow()->display();
+    }
 
+    PROFILER.EndFrame();
   }
-  delete mouseTexture;
+
+  if (INPUT.IsRecording()) {
+    INPUT.EndRecording();
+
+    if (recording.Save(recordPath)) {
+      Logger::Logf("Recorded %u frames to %s", recording.GetFrameCount(), recordPath.c_str());
+    }
+    else {
+      Logger::Log("Failed writing input recording to " + recordPath);
+    }
+  }
+
   delete logLabel;
-  delete font;
 
   return EXIT_SUCCESS;
 }
@@ -5,30 +5,24 @@ varying vec2 vTexCoord;
 
 uniform sampler2D texture; // Our render texture
 uniform sampler2D distortionMapTexture; // Our heat distortion map texture
+uniform sampler2D maskTexture; // Red is how strong the heat is. 0 away from lava.
 
 uniform float time; // Time used to scroll the distortion map
 uniform float distortionFactor; // Factor used to control severity of the effect
 uniform float riseFactor; // Factor used to control how fast air rises
 
-uniform float x;
-uniform float y;
-uniform float w;
-uniform float h;
-
-uniform vec2 textureSizeIn;
-
 void main()
 {
     gl_FragColor = texture2D(texture, vTexCoord.st);
 
-    vec2 distortionMapCoordinate = vTexCoord.st;
-    //distortionMapCoordinate.y = 1.0 - distortionMapCoordinate.y;
+    // Since we all know that hot air rises and cools,
+    // the effect loses its severity the higher up we get.
+    // The mask fades out towards the top of each lava column.
+    float percentage = texture2D(maskTexture, vTexCoord.st).r;
 
-    vec2 size = textureSizeIn;
-    vec2 screenCoord = vec2(vTexCoord.s, (vTexCoord.t)) * size;
+    if(percentage > 0.0) {
+    vec2 distortionMapCoordinate = vTexCoord.st;
 
-    if(screenCoord.x >= x && screenCoord.x <= x + w && screenCoord.y >= y && screenCoord.y <= y + h) {
-    
     // We use the time value to scroll our distortion texture upwards
     // Since we enabled texture repeating, OpenGL takes care of
     // coordinates that lie outside of [0, 1] by discarding
@@ -49,23 +43,10 @@ void main()
     // The factor scales the offset and thus controls the severity
     distortionPositionOffset *= distortionFactor;
 
-    // The latter 2 channels of the texture are unused... be creative
-    vec2 distortionUnused = distortionMapValue.zw;
-
-    // Since we all know that hot air rises and cools,
-    // the effect loses its severity the higher up we get
-    // We use the t (a.k.a. y) texture coordinate of the original texture
-    // to tell us how "high up" we are and damp accordingly
-    // Remember, OpenGL 0 is at the bottom
-
-    float percentage = 1.0 - (((y+h)-screenCoord.y )/ h);
-
-    float percentage2 = 1.0 - (((y+(h*2.0))-screenCoord.y )/ (h*2.0));
-
     distortionPositionOffset *= percentage;
     
     vec2 distortedTextureCoordinate = vTexCoord.st + distortionPositionOffset;
 
-    gl_FragColor = texture2D(texture, distortedTextureCoordinate) + (vec4(0.5,0.0,0.0,1.0)*percentage2);
+    gl_FragColor = texture2D(texture, distortedTextureCoordinate) + (vec4(0.5,0.0,0.0,1.0)*percentage*0.5);
   }
 }
@@ -6,22 +6,15 @@ varying vec4 vColor;
 
 uniform sampler2D texture; // Our render texture
 uniform sampler2D sceneTexture; // Our reflection
+uniform sampler2D maskTexture; // Green marks the ice panels
 
-uniform float x;
-uniform float y;
-uniform float w;
-uniform float h;
-uniform vec2 textureSizeIn;
 uniform float shine; // 1.0 = completely reflective. 0 = no reflection
 
 void main()
 {
     gl_FragColor = texture2D(texture, vTexCoord.st);
 
-    vec2 size = textureSizeIn;
-    vec2 screenCoord = vec2(vTexCoord.s, (vTexCoord.t)) * size;
-
-    if(screenCoord.x >= x && screenCoord.x <= x + w && screenCoord.y >= y && screenCoord.y <= y + h) {
+    if(texture2D(maskTexture, vTexCoord.st).g > 0.5) {
       // vec2 distortionMapCoordinate = vTexCoord.st; NOTE: Bump mapping?
 
       vec2 reflectionMapCoordinate = vTexCoord.st;
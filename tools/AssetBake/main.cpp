@@ -0,0 +1,74 @@
+/*! \file main.cpp
+ *  \brief AssetBake compiles the engine's text databases into resources/assets.pack
+ *
+ * Run from the BattleNetwork directory so the baked paths match the paths the engine loads:
+ *
+ *   AssetBake resources resources/assets.pack
+ *
+ * Bakes every .animation file, resources/database/library.txt, resources/database/PA.txt,
+ * and every .frag and .vert shader under the resource directory.
+ * Re-run after editing any of those files. The engine ignores stale entries on its own.
+ */
+
+#include "bnAssetPack.h"
+#include "bnFileUtil.h"
+#include "bnLogger.h"
+
+#include <filesystem>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::cerr << "usage: AssetBake <resource dir> <output pack>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  fs::path root(argv[1]);
+  std::string output(argv[2]);
+
+  if (!fs::is_directory(root)) {
+    std::cerr << "not a directory: " << root.string() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  AssetPackWriter writer;
+  int count = 0;
+
+  for (auto& item : fs::recursive_directory_iterator(root)) {
+    if (!item.is_regular_file()) continue;
+
+    // The engine always uses forward slashes
+    std::string path = item.path().generic_string();
+    std::string ext = item.path().extension().string();
+    std::string name = item.path().filename().string();
+
+    if (ext == ".animation") {
+      writer.AddAnimation(path, FileUtil::Read(path));
+    }
+    else if (ext == ".frag" || ext == ".vert") {
+      writer.AddBlob(path, FileUtil::Read(path));
+    }
+    else if (name == "library.txt" && item.path().parent_path().filename() == "database") {
+      writer.AddChipLibrary(path, FileUtil::Read(path));
+    }
+    else if (name == "PA.txt" && item.path().parent_path().filename() == "database") {
+      writer.AddProgramAdvance(path, FileUtil::Read(path));
+    }
+    else {
+      continue;
+    }
+
+    count++;
+  }
+
+  if (!writer.Write(output)) {
+    std::cerr << "could not write " << output << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  Logger::Log("Baked " + std::to_string(count) + " files into " + output);
+
+  return EXIT_SUCCESS;
+}
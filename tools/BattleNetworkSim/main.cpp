@@ -0,0 +1,137 @@
+/*! \file main.cpp
+ *  \brief BattleNetworkSim runs battles without a window, GPU or audio device
+ *
+ * Built with BN_HEADLESS so textures and shaders are never loaded from disk or compiled
+ * and the engine never gets a render surface. Run from the BattleNetwork directory
+ * so the resource paths resolve:
+ *
+ *   BattleNetworkSim [battles per mob] [mob index] [max seconds per battle] [seed]
+ *
+ * The empty sf::Texture and sf::Shader objects are still SFML GL resources, and creating
+ * the first one opens SFML's shared GL context. On Linux that needs an X display.
+ * Machines without one run the simulator under Xvfb:
+ *
+ *   xvfb-run -a BattleNetworkSim
+ *
+ * Every registered mob is simulated unless a mob index is given. Battles run
+ * unthrottled at the engine's fixed time step and the tick throughput is printed per mob.
+ * Battle b of every mob is seeded with seed + b, so the same arguments replay the same battles.
+ */
+
+#include "bnTextureResourceManager.h"
+#include "bnShaderResourceManager.h"
+#include "bnAudioResourceManager.h"
+#include "bnNaviRegistration.h"
+#include "bnMobRegistration.h"
+#include "bnChipFolder.h"
+#include "bnRandom.h"
+#include "bnBattleSimulation.h"
+#include "bnLogger.h"
+
+// Engine addons
+#include "bnQueueNaviRegistration.h"
+#include "bnQueueMobRegistration.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Same step the game updates with
+#define FIXED_TIME_STEP 1.0/60.0
+
+static void PrintUsage() {
+  std::printf("usage: BattleNetworkSim [battles per mob] [mob index] [max seconds per battle] [seed]\n\n");
+  std::printf("Run from the BattleNetwork directory so resource paths resolve.\n");
+  std::printf("SFML still creates a GL context for the empty textures and shaders,\n");
+  std::printf("so on Linux an X display is required. Without one, use: xvfb-run -a BattleNetworkSim\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1 && (std::strcmp(argv[1], "--help") == 0 || std::strcmp(argv[1], "-h") == 0)) {
+    PrintUsage();
+    return EXIT_SUCCESS;
+  }
+
+#if defined(__linux__) && !defined(__ANDROID__)
+  // SFML aborts the process when it cannot open a display. Say why instead.
+  const char* display = std::getenv("DISPLAY");
+
+  if (!display || !*display) {
+    std::fprintf(stderr, "BattleNetworkSim needs an X display for SFML's GL context. Run it with: xvfb-run -a BattleNetworkSim\n");
+    return EXIT_FAILURE;
+  }
+#endif
+
+  int battles = argc > 1 ? std::atoi(argv[1]) : 10;
+  int onlyMob = argc > 2 ? std::atoi(argv[2]) : -1;
+  double maxSeconds = argc > 3 ? std::atof(argv[3]) : 300.0;
+  uint64_t seed = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : Random::MakeSeed();
+
+  // No audio device on the farm
+  AUDIO.EnableAudio(false);
+
+  std::atomic<int> progress{ 0 };
+  TEXTURES.LoadAllTextures(progress);
+  SHADERS.LoadAllShaders(progress);
+
+  QueuNaviRegistration();
+  QueueMobRegistration();
+
+  NAVIS.LoadAllNavis(progress);
+  MOBS.LoadAllMobs(progress);
+
+  if (NAVIS.Size() == 0 || MOBS.Size() == 0) {
+    std::fprintf(stderr, "No navis or mobs registered\n");
+    return EXIT_FAILURE;
+  }
+
+  Random folderRandom(seed);
+  ChipFolder folder = ChipFolder::MakeRandomFolder(folderRandom);
+
+  std::printf("seed: %llu\n", (unsigned long long)seed);
+  std::printf("%-20s %8s %5s %5s %8s %12s %10s %14s\n", "mob", "battles", "won", "lost", "timeout", "ticks", "seconds", "ticks/sec");
+
+  unsigned long long allTicks = 0;
+  double allSeconds = 0;
+
+  for (int i = 0; i < (int)MOBS.Size(); i++) {
+    if (onlyMob >= 0 && i != onlyMob) continue;
+
+    int won = 0, lost = 0, timeout = 0;
+    unsigned long long ticks = 0;
+    double seconds = 0;
+
+    for (int b = 0; b < battles; b++) {
+      Player* player = NAVIS.At(0).GetNavi();
+      Mob* mob = MOBS.At(i).GetMob(seed + b);
+
+      BattleSimulation battle(player, mob, folder, maxSeconds);
+
+      auto start = std::chrono::steady_clock::now();
+
+      while (battle.GetOutcome() == BattleSimulation::Outcome::ongoing) {
+        battle.Step(FIXED_TIME_STEP);
+      }
+
+      seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      ticks += battle.GetTicks();
+
+      switch (battle.GetOutcome()) {
+      case BattleSimulation::Outcome::won: won++; break;
+      case BattleSimulation::Outcome::lost: lost++; break;
+      default: timeout++; break;
+      }
+    }
+
+    allTicks += ticks;
+    allSeconds += seconds;
+
+    std::printf("%-20.20s %8d %5d %5d %8d %12llu %10.3f %14.0f\n", MOBS.At(i).GetName().c_str(), battles, won, lost, timeout, ticks, seconds, seconds > 0 ? ticks / seconds : 0.0);
+  }
+
+  std::printf("total: %llu ticks in %.3f secs, %.0f ticks/sec\n", allTicks, allSeconds, allSeconds > 0 ? allTicks / allSeconds : 0.0);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+/*! \file main.cpp
+ *  \brief InputReplayTest records input for a number of ticks, saves it, loads it back and replays it
+ *
+ * The replay loop polls in the same order as the game loop in BattleNetwork/main.cpp:
+ * the recording is asked if it is finished before each tick is polled.
+ * Fails if any tick is missing or decodes different input, or if a recording
+ * whose header claims more entries than the file holds is accepted.
+ *
+ *   InputReplayTest [scratch file]
+ */
+
+#include "bnInputRecording.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+#define EXPECT(cond) \
+  do { if (!(cond)) { std::fprintf(stderr, "%s:%d: failed: %s\n", __FILE__, __LINE__, #cond); return EXIT_FAILURE; } } while (0)
+
+// Some ticks with input, some without, and none on the last tick
+static uint64_t InputForTick(uint32_t tick, InputActions& pressed, InputActions& held, InputActions& released) {
+  pressed.reset();
+  held.reset();
+  released.reset();
+
+  if (tick % 7 == 0) pressed.set((size_t)InputAction::SHOOT);
+  if (tick % 5 > 1) held.set((size_t)InputAction::MOVE_LEFT);
+  if (tick % 11 == 3) released.set((size_t)InputAction::USE_CHIP);
+
+  return InputRecording::Encode(pressed, held, released);
+}
+
+int main(int argc, char** argv) {
+  const std::string path = argc > 1 ? argv[1] : "input_replay_test.rec";
+  const uint32_t TICKS = 300;
+
+  InputActions pressed, held, released;
+
+  // Record like InputManager does: one push per polled tick
+  {
+    InputRecording recording;
+    recording.SetSeed(1234);
+
+    for (uint32_t tick = 0; tick < TICKS; tick++) {
+      uint64_t actions = tick == TICKS - 1 ? 0 : InputForTick(tick, pressed, held, released);
+      recording.Push(tick, actions);
+    }
+
+    recording.SetFrameCount(TICKS);
+    EXPECT(recording.Save(path));
+  }
+
+  InputRecording replay;
+  EXPECT(replay.Load(path));
+  EXPECT(replay.GetSeed() == 1234);
+  EXPECT(replay.GetFrameCount() == TICKS);
+
+  // Replay in the game loop's order: check, poll, simulate
+  uint32_t frame = 0;
+  size_t entry = 0;
+  uint32_t updates = 0;
+
+  while (true) {
+    if (replay.IsFinished(frame)) break;
+
+    replay.Replay(frame, entry, pressed, held, released);
+
+    InputActions expectPressed, expectHeld, expectReleased;
+    uint64_t expected = frame == TICKS - 1 ? 0 : InputForTick(frame, expectPressed, expectHeld, expectReleased);
+
+    EXPECT(InputRecording::Encode(pressed, held, released) == expected);
+
+    frame++;
+    updates++; // app.update() would run here
+  }
+
+  EXPECT(updates == TICKS);
+  EXPECT(entry == replay.GetEntries().size());
+
+  // A header that claims more entries than the file holds is rejected before allocating
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    InputRecording::Header header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    header.entryCount = 0xFFFFFFFFu;
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  }
+
+  InputRecording corrupt;
+  EXPECT(!corrupt.Load(path));
+
+  std::remove(path.c_str());
+  std::printf("replayed %u of %u ticks\n", updates, TICKS);
+
+  return EXIT_SUCCESS;
+}